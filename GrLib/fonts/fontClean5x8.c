@@ -118,6 +118,23 @@ static const uint8_t g_pui8clean5x8Data[910] =
      49,  33, 112,   7,   4,  17,  18,  17, 240, 160,
 };
 
+//*****************************************************************************
+//
+// The advance width of each character in the font.
+//
+//*****************************************************************************
+static const uint8_t g_pui8clean5x8Widths[95] =
+{
+      5,   3,   3,   5,   5,   4,   4,   3,   3,   4,   4,   5,
+      4,   5,   3,   4,   4,   4,   4,   4,   4,   4,   4,   4,
+      4,   4,   3,   4,   4,   5,   4,   4,   4,   4,   4,   4,
+      4,   4,   4,   4,   4,   4,   4,   4,   4,   4,   4,   4,
+      4,   4,   4,   4,   5,   4,   4,   4,   4,   5,   4,   3,
+      4,   4,   5,   5,   3,   4,   4,   4,   4,   4,   4,   4,
+      4,   4,   4,   4,   4,   5,   4,   4,   4,   4,   4,   4,
+      4,   4,   4,   5,   4,   4,   4,   3,   3,   4,   4,
+};
+
 const tFont g_sFontclean5x8 =
 {
     //
@@ -161,5 +178,15 @@ const tFont g_sFontclean5x8 =
     //
     // A pointer to the actual font data
     //
-    g_pui8clean5x8Data
+    g_pui8clean5x8Data,
+
+    //
+    // A pointer to the advance width of each character.
+    //
+    g_pui8clean5x8Widths,
+
+    //
+    // Whether every character is the maximum width.
+    //
+    false
 };
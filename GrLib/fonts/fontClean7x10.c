@@ -133,6 +133,23 @@ static const uint8_t g_pui8clean7x10Data[1081] =
     224,
 };
 
+//*****************************************************************************
+//
+// The advance width of each character in the font.
+//
+//*****************************************************************************
+static const uint8_t g_pui8clean7x10Widths[95] =
+{
+      7,   4,   5,   6,   6,   7,   6,   5,   5,   5,   6,   6,
+      6,   6,   5,   6,   6,   5,   6,   6,   6,   6,   6,   6,
+      6,   6,   5,   6,   6,   6,   6,   6,   6,   7,   6,   6,
+      6,   6,   6,   6,   6,   6,   6,   6,   6,   6,   6,   6,
+      6,   6,   6,   6,   6,   6,   7,   6,   6,   6,   6,   4,
+      6,   6,   6,   6,   5,   6,   6,   6,   6,   6,   6,   6,
+      6,   6,   6,   6,   5,   6,   6,   6,   6,   6,   6,   6,
+      6,   6,   7,   6,   6,   6,   6,   5,   4,   5,   6,
+};
+
 const tFont g_sFontclean7x10 =
 {
     //
@@ -176,5 +193,15 @@ const tFont g_sFontclean7x10 =
     //
     // A pointer to the actual font data
     //
-    g_pui8clean7x10Data
+    g_pui8clean7x10Data,
+
+    //
+    // A pointer to the advance width of each character.
+    //
+    g_pui8clean7x10Widths,
+
+    //
+    // Whether every character is the maximum width.
+    //
+    false
 };
@@ -165,6 +165,23 @@ static const uint8_t g_pui8courier7x13Data[1405] =
     128,
 };
 
+//*****************************************************************************
+//
+// The advance width of each character in the font.
+//
+//*****************************************************************************
+static const uint8_t g_pui8courier7x13Widths[95] =
+{
+      7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,
+      7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,
+      7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,
+      7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,
+      7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,
+      7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,
+      7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,
+      7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,
+};
+
 const tFont g_sFontcourier7x13 =
 {
     //
@@ -208,5 +225,15 @@ const tFont g_sFontcourier7x13 =
     //
     // A pointer to the actual font data
     //
-    g_pui8courier7x13Data
+    g_pui8courier7x13Data,
+
+    //
+    // A pointer to the advance width of each character.
+    //
+    g_pui8courier7x13Widths,
+
+    //
+    // Whether every character is the maximum width.
+    //
+    true
 };
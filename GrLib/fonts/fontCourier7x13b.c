@@ -162,6 +162,23 @@ static const uint8_t g_pui8courier7x13bData[1377] =
     240,  98,  33,  22,  17,  34, 240, 240, 112,
 };
 
+//*****************************************************************************
+//
+// The advance width of each character in the font.
+//
+//*****************************************************************************
+static const uint8_t g_pui8courier7x13bWidths[95] =
+{
+      7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,
+      7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,
+      7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,
+      7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,
+      7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,
+      7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,
+      7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,
+      7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,
+};
+
 const tFont g_sFontcourier7x13b =
 {
     //
@@ -205,5 +222,15 @@ const tFont g_sFontcourier7x13b =
     //
     // A pointer to the actual font data
     //
-    g_pui8courier7x13bData
+    g_pui8courier7x13bData,
+
+    //
+    // A pointer to the advance width of each character.
+    //
+    g_pui8courier7x13bWidths,
+
+    //
+    // Whether every character is the maximum width.
+    //
+    true
 };
@@ -148,6 +148,23 @@ static const uint8_t g_pui8fixed7x13Data[1424] =
      17,  17,  17,  17,  33,   0,   6,  32,
 };
 
+//*****************************************************************************
+//
+// The advance width of each character in the font.
+//
+//*****************************************************************************
+static const uint8_t g_pui8fixed7x13Widths[95] =
+{
+      7,   4,   5,   6,   6,   7,   7,   4,   5,   5,   7,   6,
+      6,   6,   5,   6,   7,   6,   7,   7,   7,   7,   7,   7,
+      7,   7,   5,   6,   6,   7,   6,   7,   7,   7,   7,   7,
+      7,   7,   7,   7,   7,   6,   7,   7,   7,   7,   7,   7,
+      7,   7,   7,   7,   6,   7,   7,   7,   7,   6,   7,   6,
+      6,   6,   6,   7,   5,   7,   7,   7,   7,   7,   7,   7,
+      7,   6,   6,   7,   6,   6,   7,   7,   7,   7,   7,   7,
+      7,   7,   6,   6,   7,   7,   7,   6,   4,   6,   6,
+};
+
 const tFont g_sFontfixed7x13 =
 {
     //
@@ -191,5 +208,15 @@ const tFont g_sFontfixed7x13 =
     //
     // A pointer to the actual font data
     //
-    g_pui8fixed7x13Data
+    g_pui8fixed7x13Data,
+
+    //
+    // A pointer to the advance width of each character.
+    //
+    g_pui8fixed7x13Widths,
+
+    //
+    // Whether every character is the maximum width.
+    //
+    false
 };
@@ -196,6 +196,23 @@ static const uint8_t g_pui8lucidabright6x12Data[1312] =
      51, 240, 240,  48,
 };
 
+//*****************************************************************************
+//
+// The advance width of each character in the font.
+//
+//*****************************************************************************
+static const uint8_t g_pui8lucidabright6x12Widths[95] =
+{
+      8,   8,   8,   8,   8,   8,   8,   8,   8,   8,   8,   8,
+      8,   8,   8,   8,   8,   8,   8,   8,   8,   8,   8,   8,
+      8,   8,   8,   8,   8,   8,   8,   8,   8,   8,   8,   8,
+      8,   8,   8,   8,   8,   8,   8,   8,   8,   8,   8,   8,
+      8,   8,   8,   8,   8,   8,   8,   8,   8,   8,   8,   8,
+      8,   8,   8,   8,   8,   8,   8,   8,   8,   8,   8,   8,
+      8,   8,   8,   8,   8,   8,   8,   8,   8,   8,   8,   8,
+      8,   8,   8,   8,   8,   8,   8,   8,   8,   8,   8,
+};
+
 const tFont g_sFontlucidabright6x12 =
 {
     //
@@ -239,5 +256,15 @@ const tFont g_sFontlucidabright6x12 =
     //
     // A pointer to the actual font data
     //
-    g_pui8lucidabright6x12Data
+    g_pui8lucidabright6x12Data,
+
+    //
+    // A pointer to the advance width of each character.
+    //
+    g_pui8lucidabright6x12Widths,
+
+    //
+    // Whether every character is the maximum width.
+    //
+    true
 };
@@ -184,6 +184,23 @@ static const uint8_t g_pui8lucidasans6x11Data[1172] =
       6, 240, 162,  34,  34, 240, 240,  16,
 };
 
+//*****************************************************************************
+//
+// The advance width of each character in the font.
+//
+//*****************************************************************************
+static const uint8_t g_pui8lucidasans6x11Widths[95] =
+{
+      6,   6,   6,   6,   6,   6,   6,   6,   6,   6,   6,   6,
+      6,   6,   6,   6,   6,   6,   6,   6,   6,   6,   6,   6,
+      6,   6,   6,   6,   6,   6,   6,   6,   6,   6,   6,   6,
+      6,   6,   6,   6,   6,   6,   6,   6,   6,   6,   6,   6,
+      6,   6,   6,   6,   6,   6,   6,   6,   6,   6,   6,   6,
+      6,   6,   6,   6,   6,   6,   6,   6,   6,   6,   6,   6,
+      6,   6,   6,   6,   6,   6,   6,   6,   6,   6,   6,   6,
+      6,   6,   6,   6,   6,   6,   6,   6,   6,   6,   6,
+};
+
 const tFont g_sFontlucidasans6x11 =
 {
     //
@@ -227,5 +244,15 @@ const tFont g_sFontlucidasans6x11 =
     //
     // A pointer to the actual font data
     //
-    g_pui8lucidasans6x11Data
+    g_pui8lucidasans6x11Data,
+
+    //
+    // A pointer to the advance width of each character.
+    //
+    g_pui8lucidasans6x11Widths,
+
+    //
+    // Whether every character is the maximum width.
+    //
+    true
 };
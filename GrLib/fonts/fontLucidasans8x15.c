@@ -225,6 +225,23 @@ static const uint8_t g_pui8lucidasans8x15Data[1658] =
       6,  96,
 };
 
+//*****************************************************************************
+//
+// The advance width of each character in the font.
+//
+//*****************************************************************************
+static const uint8_t g_pui8lucidasans8x15Widths[95] =
+{
+     10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,
+     10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,
+     10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,
+     10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,
+     10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,
+     10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,
+     10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,
+     10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,
+};
+
 const tFont g_sFontlucidasans8x15 =
 {
     //
@@ -268,5 +285,15 @@ const tFont g_sFontlucidasans8x15 =
     //
     // A pointer to the actual font data
     //
-    g_pui8lucidasans8x15Data
+    g_pui8lucidasans8x15Data,
+
+    //
+    // A pointer to the advance width of each character.
+    //
+    g_pui8lucidasans8x15Widths,
+
+    //
+    // Whether every character is the maximum width.
+    //
+    true
 };
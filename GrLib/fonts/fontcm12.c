@@ -135,6 +135,23 @@ static const uint8_t g_pucCm12Data[1375] = { 5, 5, 0, 8, 16, 11, 2, 33,
 		240, 240, 208, 8, 12, 0, 9, 11, 0, 9, 16, 7, 4, 129, 17, 240, 240, 176,
 		7, 5, 162, 17, 0, 6, 48, };
 
+//*****************************************************************************
+//
+// The advance width of each character in the font.
+//
+//*****************************************************************************
+static const uint8_t g_pucCm12Widths[95] =
+{
+      5,   2,   5,   9,   6,  10,  10,   3,   4,   4,   3,   8,
+      3,   4,   2,   5,   6,   4,   6,   5,   6,   6,   6,   5,
+      5,   6,   2,   2,   2,   8,   6,   6,   9,   9,   8,   9,
+      9,   9,   9,   9,   9,   4,   5,   9,   7,  10,   8,   9,
+      8,   9,  10,   7,   9,   9,   9,  12,   9,  10,   7,   3,
+      5,   3,   4,   2,   3,   7,   7,   5,   7,   6,   5,   7,
+      7,   3,   3,   7,   4,  10,   7,   6,   7,   7,   5,   5,
+      6,   7,   6,   8,   7,   7,   5,   7,  12,   4,   5,
+};
+
 //*****************************************************************************
 //
 // The font definition for the 12 point Cm font.
@@ -176,4 +193,15 @@ const Graphics_Font g_sFontCm12 = {
 		//
 		// A pointer to the actual font data
 		//
-		g_pucCm12Data };
+		g_pucCm12Data,
+
+		//
+		// A pointer to the advance width of each character.
+		//
+		g_pucCm12Widths,
+
+		//
+		// Whether every character is the maximum width.
+		//
+		false
+};
@@ -168,6 +168,23 @@ static const uint8_t g_pucCm12bData[1328] =
     176,   7,   5,  82,  17,   0,   6,  48,
 };
 
+//*****************************************************************************
+//
+// The advance width of each character in the font.
+//
+//*****************************************************************************
+static const uint8_t g_pucCm12bWidths[95] =
+{
+      5,   2,   6,   9,   5,   9,   9,   3,   3,   3,   6,  10,
+      3,   4,   2,   6,   5,   4,   5,   5,   6,   5,   5,   5,
+      5,   5,   2,   2,   2,   9,   4,   4,  10,   9,   7,   7,
+      8,   7,   7,   8,   8,   4,   6,   9,   6,  11,  10,   7,
+      7,   7,   8,   6,   8,   9,  10,  13,  10,   8,   7,   3,
+      6,   3,   4,   2,   3,   7,   7,   5,   7,   6,   5,   6,
+      7,   4,   5,   7,   4,  11,   7,   6,   7,   7,   5,   5,
+      5,   7,   7,   9,   7,   6,   5,   7,  13,   4,   5,
+};
+
 //*****************************************************************************
 //
 // The font definition for the 12 point Cm bold font.
@@ -216,5 +233,15 @@ const Graphics_Font g_sFontCm12b =
     //
     // A pointer to the actual font data
     //
-    g_pucCm12bData
+    g_pucCm12bData,
+
+    //
+    // A pointer to the advance width of each character.
+    //
+    g_pucCm12bWidths,
+
+    //
+    // Whether every character is the maximum width.
+    //
+    false
 };
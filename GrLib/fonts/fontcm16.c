@@ -214,6 +214,23 @@ static const uint8_t g_pucCm16Data[1881] =
      48,   8,   6, 240,  51,  17,   0,   9, 112,
 };
 
+//*****************************************************************************
+//
+// The advance width of each character in the font.
+//
+//*****************************************************************************
+static const uint8_t g_pucCm16Widths[95] =
+{
+      6,   2,   6,  12,   7,  12,  13,   3,   4,   4,   7,  12,
+      3,   5,   2,   7,   7,   6,   6,   7,   8,   7,   7,   7,
+      8,   7,   2,   2,   2,  11,   6,   6,  12,  12,   9,  11,
+     10,  10,  10,  11,  10,   4,   7,  11,   8,  12,  11,  10,
+      9,  11,  12,   8,  11,  11,  12,  16,  12,  12,   9,   4,
+      6,   4,   5,   2,   3,   8,   9,   7,   9,   7,   5,   8,
+      8,   4,   5,   8,   4,  12,   8,   8,   8,   9,   6,   7,
+      7,   8,   8,  12,   9,   8,   7,   9,  16,   5,   6,
+};
+
 //*****************************************************************************
 //
 // The font definition for the 16 point Cm font.
@@ -262,5 +279,15 @@ const Graphics_Font g_sFontCm16 =
     //
     // A pointer to the actual font data
     //
-    g_pucCm16Data
+    g_pucCm16Data,
+
+    //
+    // A pointer to the advance width of each character.
+    //
+    g_pucCm16Widths,
+
+    //
+    // Whether every character is the maximum width.
+    //
+    false
 };
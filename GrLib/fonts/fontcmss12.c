@@ -166,6 +166,23 @@ static const uint8_t g_pucCmss12Data[1300] =
     131, 240, 240, 176,
 };
 
+//*****************************************************************************
+//
+// The advance width of each character in the font.
+//
+//*****************************************************************************
+static const uint8_t g_pucCmss12Widths[95] =
+{
+      5,   2,   4,   9,   5,   9,   9,   2,   4,   4,   4,   8,
+      2,   4,   2,   5,   6,   4,   6,   5,   6,   5,   6,   5,
+      6,   6,   2,   2,   2,   8,   4,   5,   7,   8,   7,   7,
+      7,   6,   6,   7,   7,   2,   5,   7,   6,   9,   7,   8,
+      6,   8,   7,   6,   8,   7,   8,  11,   7,   8,   6,   3,
+      4,   3,   4,   2,   2,   5,   5,   5,   6,   6,   5,   6,
+      5,   2,   4,   5,   2,   8,   5,   6,   5,   6,   4,   5,
+      5,   5,   6,   8,   6,   6,   5,   7,  12,   5,   4,
+};
+
 //*****************************************************************************
 //
 // The font definition for the 12 point Cmss font.
@@ -214,5 +231,15 @@ const Graphics_Font g_sFontCmss12 =
     //
     // A pointer to the actual font data
     //
-    g_pucCmss12Data
+    g_pucCmss12Data,
+
+    //
+    // A pointer to the advance width of each character.
+    //
+    g_pucCmss12Widths,
+
+    //
+    // Whether every character is the maximum width.
+    //
+    false
 };
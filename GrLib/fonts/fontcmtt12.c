@@ -167,6 +167,23 @@ static const uint8_t g_pucCmtt12Data[1313] =
      50,  17,   0,   9,  32,
 };
 
+//*****************************************************************************
+//
+// The advance width of each character in the font.
+//
+//*****************************************************************************
+static const uint8_t g_pucCmtt12Widths[95] =
+{
+      8,   8,   8,   8,   8,   8,   8,   8,   8,   8,   8,   8,
+      8,   8,   8,   8,   8,   8,   8,   8,   8,   8,   8,   8,
+      8,   8,   8,   8,   8,   8,   8,   8,   8,   8,   8,   8,
+      8,   8,   8,   8,   8,   8,   8,   8,   8,   8,   8,   8,
+      8,   8,   8,   8,   8,   8,   8,   8,   8,   8,   8,   8,
+      8,   8,   8,   8,   8,   8,   8,   8,   8,   8,   8,   8,
+      8,   8,   8,   8,   8,   8,   8,   8,   8,   8,   8,   8,
+      8,   8,   8,   8,   8,   8,   8,   8,   8,   8,   8,
+};
+
 //*****************************************************************************
 //
 // The font definition for the 12 point Cmtt font.
@@ -215,5 +232,15 @@ const Graphics_Font g_sFontCmtt12 =
     //
     // A pointer to the actual font data
     //
-    g_pucCmtt12Data
+    g_pucCmtt12Data,
+
+    //
+    // A pointer to the advance width of each character.
+    //
+    g_pucCmtt12Widths,
+
+    //
+    // Whether every character is the maximum width.
+    //
+    false
 };
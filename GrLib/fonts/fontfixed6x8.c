@@ -84,6 +84,23 @@ static const uint8_t g_pucFontFixed6x8Data[760] =
       0,   0,   0,   0,
 };
 
+//*****************************************************************************
+//
+// The advance width of each character in the font.
+//
+//*****************************************************************************
+static const uint8_t g_pucFontFixed6x8Widths[95] =
+{
+      6,   6,   6,   6,   6,   6,   6,   6,   6,   6,   6,   6,
+      6,   6,   6,   6,   6,   6,   6,   6,   6,   6,   6,   6,
+      6,   6,   6,   6,   6,   6,   6,   6,   6,   6,   6,   6,
+      6,   6,   6,   6,   6,   6,   6,   6,   6,   6,   6,   6,
+      6,   6,   6,   6,   6,   6,   6,   6,   6,   6,   6,   6,
+      6,   6,   6,   6,   6,   6,   6,   6,   6,   6,   6,   6,
+      6,   6,   6,   6,   6,   6,   6,   6,   6,   6,   6,   6,
+      6,   6,   6,   6,   6,   6,   6,   6,   6,   6,   6,
+};
+
 //*****************************************************************************
 //
 // The font definition for the fixed-point 6x8 font.
@@ -132,5 +149,15 @@ const Graphics_Font g_sFontFixed6x8 =
     //
     // A pointer to the actual font data
     //
-    g_pucFontFixed6x8Data
+    g_pucFontFixed6x8Data,
+
+    //
+    // A pointer to the advance width of each character.
+    //
+    g_pucFontFixed6x8Widths,
+
+    //
+    // Whether every character is the maximum width.
+    //
+    true
 };
@@ -63,6 +63,52 @@ void Graphics_drawMultiplePixelsOnDisplay(const Graphics_Display *display,
 			data, palette);
 }
 
+//*****************************************************************************
+//
+//! Draws a rectangle of uncompressed image data on a display.
+//!
+//! \param display is the pointer to the display driver structure for the
+//! display to operate upon.
+//! \param x is the X coordinate of the upper left pixel.
+//! \param y is the Y coordinate of the upper left pixel.
+//! \param x0 is sub-pixel offset within the pixel data of each row, which is
+//! valid for 1 or 4 bit per pixel formats.
+//! \param width is the number of pixels in each row.
+//! \param height is the number of rows.
+//! \param bPP is the number of bits per pixel; must be 1, 4, 8 or 16.
+//! \param data is a pointer to the pixel data of the first row.
+//! \param stride is the number of bytes from the start of one row of pixel
+//! data to the start of the next.
+//! \param palette is a pointer to the palette used to draw the pixels.
+//!
+//! This function draws a block of pixels, the way height calls to
+//! Graphics_drawMultiplePixelsOnDisplay() would.  Drivers that provide
+//! callImageBlit can send it as a single transfer; for the others it is drawn
+//! a row at a time.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void Graphics_blitImageOnDisplay(const Graphics_Display *display,
+		uint16_t x, uint16_t y, uint16_t x0, uint16_t width, uint16_t height,
+		uint16_t bPP, const uint8_t *data, uint16_t stride,
+		const uint32_t *palette)
+{
+	if(display->callImageBlit)
+	{
+		display->callImageBlit(display->displayData, x, y, x0, width, height,
+				bPP, data, stride, palette);
+		return;
+	}
+
+	while(height--)
+	{
+		display->callPixelDrawMultiple(display->displayData, x, y++, x0,
+				width, bPP, data, palette);
+		data += stride;
+	}
+}
+
 
 //*****************************************************************************
 //
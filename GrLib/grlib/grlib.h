@@ -95,6 +95,10 @@ typedef struct Graphics_Display
     uint32_t (*callColorTranslate)(void *displayData, uint32_t  value);	//!< A pointer to the function to translate 24-bit RGB colors to display-specific colors.
     void (*callFlush)(void *displayData); //!< A pointer to the function to flush any cached drawing operations on this display.
     void (*callClearDisplay)(void *displayData, uint16_t value); //!<  A pointer to the function to clears Display. Contents of display buffer unmodified
+    void (*callImageBlit)(void *displayData, int16_t x, int16_t y,
+    		int16_t x0, int16_t width, int16_t height, int16_t bPP,
+    		const uint8_t *data, int16_t stride,
+    		const uint32_t *pucPalette); //!< An optional pointer to the function to draw a rectangle of uncompressed image data on this display; NULL draws the image a row at a time.
 } Graphics_Display;
 
 //*****************************************************************************
@@ -110,6 +114,8 @@ typedef struct Graphics_Font
     uint8_t baseline;	//!< The offset between the top of the character cell and the baseline of  the glyph.  The baseline is the bottom row of a capital letter, below which only the descenders of the lower case letters occur.
     uint16_t offset[96];//!< The offset within data to the data for each character in the font.
     const uint8_t *data;//!< A pointer to the data for the font.
+    const uint8_t *widths;//!< A pointer to the advance width of each character in the font, or 0 if the widths are only in the data.
+    bool fixedWidth;	//!< True if every character in the font is maxWidth wide.
 } Graphics_Font;
 
 //*****************************************************************************
@@ -134,8 +140,22 @@ typedef struct Graphics_FontEx
     uint8_t last;			//!< The codepoint number representing the last character encoded in the font.
     const uint16_t *offset;	//!< A pointer to a table containing the offset within data to the data for each character in the font.
     const uint8_t *data;	//!< A pointer to the data for the font.
+    const uint8_t *widths;	//!< A pointer to the advance width of each character in the font, or 0 if the widths are only in the data.
+    bool fixedWidth;		//!< True if every character in the font is maxWidth wide.
 } Graphics_FontEx;
 
+//*****************************************************************************
+//
+//! This structure holds the counters of the decoded glyph cache used by
+//! Graphics_drawString().
+//
+//*****************************************************************************
+typedef struct Graphics_GlyphCacheStats
+{
+    uint32_t hits;			//!< The glyphs drawn from the cache.
+    uint32_t misses;		//!< The glyphs decoded from the font data.
+} Graphics_GlyphCacheStats;
+
 //*****************************************************************************
 //
 //! This structure defines a drawing context to be used to draw onto the
@@ -979,9 +999,14 @@ extern uint32_t Graphics_getOffScreen8BPPSize(uint16_t width, uint16_t height);
 extern void  Graphics_drawStringCentered(const Graphics_Context *context,
 		int8_t *string, int32_t  length, int32_t  x, int32_t  y,
 		bool  opaque);
+extern void Graphics_drawStringCenteredWidth(const Graphics_Context *context,
+		int8_t *string, int32_t  length, int32_t  x, int32_t  y,
+		bool  opaque, int32_t  width);
 extern uint8_t Graphics_getStringHeight(const Graphics_Context *context);
 extern uint8_t Graphics_getStringMaxWidth(const Graphics_Context *context);
 extern uint8_t Graphics_getStringBaseline(const Graphics_Context *context);
+extern const Graphics_GlyphCacheStats *Graphics_getGlyphCacheStats(void);
+extern void Graphics_clearGlyphCache(void);
 extern uint32_t Graphics_translateColorOnDisplay(const Graphics_Display *display,
 		uint32_t value);
 extern void Graphics_drawHorizontalLineOnDisplay(
@@ -1008,6 +1033,10 @@ extern void Graphics_drawMultiplePixelsOnDisplay(
 		const Graphics_Display *display, uint16_t x, uint16_t y, uint16_t x0,
 		uint16_t  count, uint16_t bPP, const uint8_t *data,
 		const uint32_t *pucPalette);
+extern void Graphics_blitImageOnDisplay(const Graphics_Display *display,
+		uint16_t x, uint16_t y, uint16_t x0, uint16_t width, uint16_t height,
+		uint16_t bPP, const uint8_t *data, uint16_t stride,
+		const uint32_t *pucPalette);
 extern void Graphics_initOffscreen1BppImage(Graphics_Display *display,
         uint8_t *image, int32_t width, int32_t height);
 extern void Graphics_initOffscreen4BppImage(Graphics_Display *display,
@@ -15,6 +15,15 @@
 //*****************************************************************************
 static uint32_t g_pulConvertedPalette[256];
 
+//*****************************************************************************
+//
+// Pixels of a compressed image row handed to the display at a time.
+//
+//*****************************************************************************
+#ifndef GRAPHICS_RLE_CHUNK
+#define GRAPHICS_RLE_CHUNK 32
+#endif
+
 
 //*****************************************************************************
 //
@@ -188,111 +197,85 @@ void Graphics_drawImage(const Graphics_Context *context,
             y += x1;
         }
         
-        while(height--)
+        //
+        // Draw the visible rows of image pixels.
+        //
+        if(height > 0)
         {
-          //
-          // Draw this row of image pixels.
-          //
-        	Graphics_drawMultiplePixelsOnDisplay(context->display, x + x0, y,
-        			x0 & 7, x2 - x0 + 1, bPP, image + ((x0 * bPP) / 8),
+        	Graphics_blitImageOnDisplay(context->display, x + x0, y,
+        			x0 & 7, x2 - x0 + 1, height, bPP,
+        			image + ((x0 * bPP) / 8), ((width * bPP) + 7) / 8,
         			palette);
-          
-          //
-          // Skip past the data for this row.
-          //
-          image += ((width * bPP) + 7) / 8;
-          
-          //
-          // Increment the Y coordinate.
-          //
-          y++;
         }
     }
     else
+    {
+        //
+        // The image is compressed with RLE4 or RLE8.  Each run is one pixel
+        // plus the run length in the upper bits, of the color in the lower
+        // ones, and may carry over to the next row.  Rows are decoded in
+        // full, but only the part inside the clipping region is drawn, a
+        // chunk of palette indices at a time.
+        //
+        uint8_t pucChunk[GRAPHICS_RLE_CHUNK];
+        uint16_t uiRun = 0;
+        uint8_t ucColor = 0;
+        int16_t lCol, lCount, lStart, lFill;
+
+        bPP &= 0x0F;
+
+        for(x1 = 0; x1 < height; x1++, y++)
         {
-           //
-           // The image is compressed with RLE4 or RLE8 Algorithm
-           //
-
-          const uint8_t *pucData = image;
-          uint8_t ucRunLength, ucTempRun;
-          uint8_t ucNoOverrun = 1;
-          uint16_t uiColor;
-          uint16_t uiLineCnt = 0;
-          uint16_t xS = x;
-
-           bPP &= 0x0F;
-
-           while(height--)
-           {
-             //
-             // Draw this row of image pixels.
-             //
-             while(uiLineCnt < width)
-             {
-               if(ucNoOverrun)      // Read next byte
-               {
-                 if(bPP == 8)      // RLE 8 bit encoding
-                 {
-                   // Read Run Length
-                   ucRunLength = *pucData++;
-                   // Read Color Pointer
-                   uiColor = *pucData++;
-                 }
-                 else     // bPP = 4; RLE 4 bit encoding
-                 {
-
-                   // Read Run Length
-                   ucRunLength = (*pucData) >> 4;
-                   // Read Color Pointer
-                   uiColor = (*pucData++) & 0x0F;
-                 }
-                 uiColor = (*(uint16_t *)(palette + uiColor));
-
-               }
-               else
-               {
-                 //Last line run overran the edge
-                 //Skip color and run length update and clear overrun flag
-                 ucNoOverrun = 1;
-                 ucRunLength = ucTempRun;
-               }
-
-               //After original value, but it still needs to be written once
-               if((ucRunLength + uiLineCnt) >= width)
-               {
-                 //Run length runs past current line
-
-                 //Set left over run length for next line to ucTempRun
-                 ucTempRun = ucRunLength - (width - uiLineCnt);
-                 //Set ucRunLength to finish this line
-                 ucRunLength = (width - uiLineCnt);
-                 //Set line overrun flag
-                 ucNoOverrun = 0;
-               }
-
-               //Draw single pixel
-               Graphics_drawPixelOnDisplay(context->display, x, y, uiColor);
-			   x++;
-
-               uiLineCnt++;
-
-               while(ucRunLength--)
-               {
-                 //Draw run of pixels
-            	Graphics_drawPixelOnDisplay(context->display, x, y, uiColor);
-
-				x++;
-
-				uiLineCnt++;
-               }
-             }
-             //End of line reached
-             uiLineCnt = 0;   //Reset Pixel Count
-             y++;            //Increment Y value
-             x = xS;
-           }
-       }
+            lFill = 0;
+            lStart = x0;
+
+            for(lCol = 0; lCol < width; )
+            {
+                if(!uiRun)
+                {
+                    if(bPP == 8)
+                    {
+                        uiRun = *image++ + 1;
+                        ucColor = *image++;
+                    }
+                    else
+                    {
+                        uiRun = (*image >> 4) + 1;
+                        ucColor = *image++ & 0x0F;
+                    }
+                }
+
+                lCount = width - lCol;
+                if(lCount > uiRun)
+                {
+                    lCount = uiRun;
+                }
+                uiRun -= lCount;
+
+                //
+                // Rows above the clipping region are only decoded.
+                //
+                for(; (y >= context->clipRegion.yMin) && lCount; lCount--,
+                    lCol++)
+                {
+                    if((lCol < x0) || (lCol > x2))
+                    {
+                        continue;
+                    }
+                    pucChunk[lFill++] = ucColor;
+                    if((lFill == GRAPHICS_RLE_CHUNK) || (lCol == x2))
+                    {
+                        Graphics_blitImageOnDisplay(context->display,
+                                x + lStart, y, 0, lFill, 1, 8, pucChunk,
+                                lFill, palette);
+                        lStart += lFill;
+                        lFill = 0;
+                    }
+                }
+                lCol += lCount;
+            }
+        }
+    }
 }
 
 //*****************************************************************************
@@ -0,0 +1,322 @@
+#include "grlib.h"
+
+//*****************************************************************************
+//
+//! \addtogroup offscreen_api
+//! @{
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//
+// The buffer of a 1 BPP off-screen image holds a 5 byte header (format, and
+// width and height as 16-bit little-endian values) and then the rows of
+// pixels, eight pixels per byte with the left one in the most significant
+// bit.  Display colors are 0 for black and 1 for white.
+//
+//*****************************************************************************
+#define OFFSCREEN_PIXELS        5
+
+#define OFFSCREEN_WIDTH(data)   ((data)[1] | ((uint16_t)(data)[2] << 8))
+
+//*****************************************************************************
+//
+// Returns a pointer to the byte holding pixel (x, y).
+//
+//*****************************************************************************
+static uint8_t *
+Graphics_offscreen1BppPointer(uint8_t *data, int16_t x, int16_t y)
+{
+    return(data + OFFSCREEN_PIXELS +
+           ((OFFSCREEN_WIDTH(data) + 7) / 8) * y + (x / 8));
+}
+
+//*****************************************************************************
+//
+//! Draws a pixel on a 1 BPP off-screen image.
+//!
+//! \param displayData is a pointer to the image buffer.
+//! \param x is the X coordinate of the pixel.
+//! \param y is the Y coordinate of the pixel.
+//! \param value is the color of the pixel, 0 or 1.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void
+Graphics_offscreen1BppPixelDraw(void *displayData, int16_t x, int16_t y,
+                                uint16_t value)
+{
+    uint8_t *pixel = Graphics_offscreen1BppPointer(displayData, x, y);
+
+    if(value & 1)
+    {
+        *pixel |= 0x80 >> (x & 7);
+    }
+    else
+    {
+        *pixel &= ~(0x80 >> (x & 7));
+    }
+}
+
+//*****************************************************************************
+//
+//! Draws a horizontal sequence of pixels on a 1 BPP off-screen image.
+//!
+//! \param displayData is a pointer to the image buffer.
+//! \param x is the X coordinate of the first pixel.
+//! \param y is the Y coordinate of the first pixel.
+//! \param x0 is sub-pixel offset within the pixel data, which is valid for 1
+//! or 4 bit per pixel formats.
+//! \param count is the number of pixels to draw.
+//! \param bPP is the number of bits per pixel; must be 1, 4, or 8.
+//! \param data is a pointer to the pixel data.  For 1 and 4 bit per pixel
+//! formats, the most significant bit(s) represent the left-most pixel.
+//! \param palette is a pointer to the palette used to draw the pixels, already
+//! translated to colors of this image.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void
+Graphics_offscreen1BppPixelDrawMultiple(void *displayData, int16_t x,
+                                        int16_t y, int16_t x0, int16_t count,
+                                        int16_t bPP, const uint8_t *data,
+                                        const uint32_t *palette)
+{
+    uint16_t value;
+
+    while(count--)
+    {
+        switch(bPP)
+        {
+            case 1:
+                value = palette[(*data >> (7 - x0)) & 1];
+                if(++x0 == 8)
+                {
+                    x0 = 0;
+                    data++;
+                }
+                break;
+
+            case 4:
+                if(x0 & 1)
+                {
+                    value = palette[*data++ & 0x0f];
+                }
+                else
+                {
+                    value = palette[*data >> 4];
+                }
+                x0++;
+                break;
+
+            case 8:
+            default:
+                value = palette[*data++];
+                break;
+        }
+
+        Graphics_offscreen1BppPixelDraw(displayData, x++, y, value);
+    }
+}
+
+//*****************************************************************************
+//
+//! Draws a horizontal line on a 1 BPP off-screen image.
+//!
+//! \param displayData is a pointer to the image buffer.
+//! \param x1 is the X coordinate of the start of the line.
+//! \param x2 is the X coordinate of the end of the line.
+//! \param y is the Y coordinate of the line.
+//! \param value is the color of the line, 0 or 1.
+//!
+//! The whole bytes in the middle of the line are written eight pixels at a
+//! time.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void
+Graphics_offscreen1BppLineDrawH(void *displayData, int16_t x1, int16_t x2,
+                                int16_t y, uint16_t value)
+{
+    uint8_t *pixel = Graphics_offscreen1BppPointer(displayData, x1, y);
+    uint8_t fill = (value & 1) ? 0xff : 0x00;
+    uint8_t mask;
+
+    if((x1 & 7) || ((x2 - x1) < 7))
+    {
+        mask = 0xff >> (x1 & 7);
+        if((x2 - (x1 & ~7)) < 7)
+        {
+            mask &= 0xff << (7 - (x2 & 7));
+        }
+        *pixel = (*pixel & ~mask) | (fill & mask);
+        pixel++;
+        x1 = (x1 & ~7) + 8;
+    }
+
+    for(; (x1 + 7) <= x2; x1 += 8)
+    {
+        *pixel++ = fill;
+    }
+
+    if(x1 <= x2)
+    {
+        mask = 0xff << (7 - (x2 & 7));
+        *pixel = (*pixel & ~mask) | (fill & mask);
+    }
+}
+
+//*****************************************************************************
+//
+//! Draws a vertical line on a 1 BPP off-screen image.
+//!
+//! \param displayData is a pointer to the image buffer.
+//! \param x is the X coordinate of the line.
+//! \param y1 is the Y coordinate of the start of the line.
+//! \param y2 is the Y coordinate of the end of the line.
+//! \param value is the color of the line, 0 or 1.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void
+Graphics_offscreen1BppLineDrawV(void *displayData, int16_t x, int16_t y1,
+                                int16_t y2, uint16_t value)
+{
+    for(; y1 <= y2; y1++)
+    {
+        Graphics_offscreen1BppPixelDraw(displayData, x, y1, value);
+    }
+}
+
+//*****************************************************************************
+//
+//! Fills a rectangle on a 1 BPP off-screen image.
+//!
+//! \param displayData is a pointer to the image buffer.
+//! \param rect is a pointer to the structure containing the extents of the
+//! rectangle.
+//! \param value is the color of the rectangle, 0 or 1.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void
+Graphics_offscreen1BppRectFill(void *displayData,
+                               const Graphics_Rectangle *rect, uint16_t value)
+{
+    int16_t y;
+
+    for(y = rect->yMin; y <= rect->yMax; y++)
+    {
+        Graphics_offscreen1BppLineDrawH(displayData, rect->xMin, rect->xMax, y,
+                                        value);
+    }
+}
+
+//*****************************************************************************
+//
+//! Translates a 24-bit RGB color to black or white.
+//!
+//! \param displayData is a pointer to the image buffer.
+//! \param value is the 24-bit RGB color.
+//!
+//! Colors at least half as bright as white, weighting red, green and blue by
+//! 77, 150 and 29 out of 256, become 1.
+//!
+//! \return Returns 1 for a light color and 0 for a dark one.
+//
+//*****************************************************************************
+static uint32_t
+Graphics_offscreen1BppColorTranslate(void *displayData, uint32_t value)
+{
+    uint32_t luma;
+
+    luma = (((value >> 16) & 0xff) * 77) + (((value >> 8) & 0xff) * 150) +
+           ((value & 0xff) * 29);
+
+    return((luma >= (128UL << 8)) ? 1 : 0);
+}
+
+//*****************************************************************************
+//
+//! Flushes any cached drawing operations; nothing is cached off-screen.
+//
+//*****************************************************************************
+static void
+Graphics_offscreen1BppFlush(void *displayData)
+{
+}
+
+//*****************************************************************************
+//
+//! Fills a 1 BPP off-screen image with one color.
+//
+//*****************************************************************************
+static void
+Graphics_offscreen1BppClearScreen(void *displayData, uint16_t value)
+{
+    uint8_t *data = displayData;
+    uint8_t *pixel = data + OFFSCREEN_PIXELS;
+    uint8_t fill = (value & 1) ? 0xff : 0x00;
+    uint32_t count;
+
+    count = (uint32_t)((OFFSCREEN_WIDTH(data) + 7) / 8) *
+            (data[3] | ((uint16_t)data[4] << 8));
+
+    while(count--)
+    {
+        *pixel++ = fill;
+    }
+}
+
+//*****************************************************************************
+//
+//! Initializes a 1 BPP off-screen image.
+//!
+//! \param display is a pointer to the display structure to fill in.
+//! \param image is a pointer to the image buffer, at least
+//! Graphics_getOffscreen1BppImageSize() bytes.
+//! \param width is the width of the image in pixels.
+//! \param height is the height of the image in pixels.
+//!
+//! This function fills in a display structure that draws into the image
+//! buffer, so that a context initialized with it composes an image in
+//! memory.  Whole-image draws go a row at a time through the pixel callback.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void Graphics_initOffscreen1BppImage(Graphics_Display *display,
+        uint8_t *image, int32_t width, int32_t height)
+{
+    image[0] = GRAPHICS_IMAGE_FMT_1BPP_UNCOMP;
+    image[1] = width & 0xff;
+    image[2] = width >> 8;
+    image[3] = height & 0xff;
+    image[4] = height >> 8;
+
+    display->size = sizeof(Graphics_Display);
+    display->displayData = image;
+    display->width = width;
+    display->heigth = height;
+    display->callPixelDraw = Graphics_offscreen1BppPixelDraw;
+    display->callPixelDrawMultiple = Graphics_offscreen1BppPixelDrawMultiple;
+    display->callLineDrawH = Graphics_offscreen1BppLineDrawH;
+    display->callLineDrawV = Graphics_offscreen1BppLineDrawV;
+    display->callRectFill = Graphics_offscreen1BppRectFill;
+    display->callColorTranslate = Graphics_offscreen1BppColorTranslate;
+    display->callFlush = Graphics_offscreen1BppFlush;
+    display->callClearDisplay = Graphics_offscreen1BppClearScreen;
+    display->callImageBlit = 0;
+}
+
+//*****************************************************************************
+//
+// Close the Doxygen group.
+//! @}
+//
+//*****************************************************************************
@@ -0,0 +1,367 @@
+#include "grlib.h"
+
+//*****************************************************************************
+//
+//! \addtogroup offscreen_api
+//! @{
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//
+// The buffer of a 4 BPP off-screen image holds a 6 byte header (format,
+// width and height as 16-bit little-endian values, and the number of palette
+// entries less one), a palette of 16 entries stored as blue, green and red
+// bytes, and then the rows of pixels, two pixels per byte with the left one
+// in the upper nibble.  Display colors are palette indices.
+//
+//*****************************************************************************
+#define OFFSCREEN_PALETTE       6
+#define OFFSCREEN_PIXELS        (OFFSCREEN_PALETTE + (16 * 3))
+
+#define OFFSCREEN_WIDTH(data)   ((data)[1] | ((uint16_t)(data)[2] << 8))
+
+//*****************************************************************************
+//
+// Returns a pointer to the byte holding pixel (x, y).
+//
+//*****************************************************************************
+static uint8_t *
+Graphics_offscreen4BppPointer(uint8_t *data, int16_t x, int16_t y)
+{
+    return(data + OFFSCREEN_PIXELS +
+           ((OFFSCREEN_WIDTH(data) + 1) / 2) * y + (x / 2));
+}
+
+//*****************************************************************************
+//
+//! Draws a pixel on a 4 BPP off-screen image.
+//!
+//! \param displayData is a pointer to the image buffer.
+//! \param x is the X coordinate of the pixel.
+//! \param y is the Y coordinate of the pixel.
+//! \param value is the palette index of the pixel.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void
+Graphics_offscreen4BppPixelDraw(void *displayData, int16_t x, int16_t y,
+                                uint16_t value)
+{
+    uint8_t *pixel = Graphics_offscreen4BppPointer(displayData, x, y);
+
+    if(x & 1)
+    {
+        *pixel = (*pixel & 0xf0) | (value & 0x0f);
+    }
+    else
+    {
+        *pixel = (*pixel & 0x0f) | (value << 4);
+    }
+}
+
+//*****************************************************************************
+//
+//! Draws a horizontal sequence of pixels on a 4 BPP off-screen image.
+//!
+//! \param displayData is a pointer to the image buffer.
+//! \param x is the X coordinate of the first pixel.
+//! \param y is the Y coordinate of the first pixel.
+//! \param x0 is sub-pixel offset within the pixel data, which is valid for 1
+//! or 4 bit per pixel formats.
+//! \param count is the number of pixels to draw.
+//! \param bPP is the number of bits per pixel; must be 1, 4, or 8.
+//! \param data is a pointer to the pixel data.  For 1 and 4 bit per pixel
+//! formats, the most significant bit(s) represent the left-most pixel.
+//! \param palette is a pointer to the palette used to draw the pixels, already
+//! translated to palette indices of this image.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void
+Graphics_offscreen4BppPixelDrawMultiple(void *displayData, int16_t x,
+                                        int16_t y, int16_t x0, int16_t count,
+                                        int16_t bPP, const uint8_t *data,
+                                        const uint32_t *palette)
+{
+    uint16_t value;
+
+    while(count--)
+    {
+        switch(bPP)
+        {
+            case 1:
+                value = palette[(*data >> (7 - x0)) & 1];
+                if(++x0 == 8)
+                {
+                    x0 = 0;
+                    data++;
+                }
+                break;
+
+            case 4:
+                if(x0 & 1)
+                {
+                    value = palette[*data++ & 0x0f];
+                }
+                else
+                {
+                    value = palette[*data >> 4];
+                }
+                x0++;
+                break;
+
+            case 8:
+            default:
+                value = palette[*data++];
+                break;
+        }
+
+        Graphics_offscreen4BppPixelDraw(displayData, x++, y, value);
+    }
+}
+
+//*****************************************************************************
+//
+//! Draws a horizontal line on a 4 BPP off-screen image.
+//!
+//! \param displayData is a pointer to the image buffer.
+//! \param x1 is the X coordinate of the start of the line.
+//! \param x2 is the X coordinate of the end of the line.
+//! \param y is the Y coordinate of the line.
+//! \param value is the palette index of the line.
+//!
+//! The whole bytes in the middle of the line are written two pixels at a
+//! time.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void
+Graphics_offscreen4BppLineDrawH(void *displayData, int16_t x1, int16_t x2,
+                                int16_t y, uint16_t value)
+{
+    uint8_t *pixel = Graphics_offscreen4BppPointer(displayData, x1, y);
+
+    value &= 0x0f;
+
+    if(x1 & 1)
+    {
+        *pixel = (*pixel & 0xf0) | value;
+        pixel++;
+        x1++;
+    }
+
+    for(; x1 < x2; x1 += 2)
+    {
+        *pixel++ = (value << 4) | value;
+    }
+
+    if(x1 == x2)
+    {
+        *pixel = (*pixel & 0x0f) | (value << 4);
+    }
+}
+
+//*****************************************************************************
+//
+//! Draws a vertical line on a 4 BPP off-screen image.
+//!
+//! \param displayData is a pointer to the image buffer.
+//! \param x is the X coordinate of the line.
+//! \param y1 is the Y coordinate of the start of the line.
+//! \param y2 is the Y coordinate of the end of the line.
+//! \param value is the palette index of the line.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void
+Graphics_offscreen4BppLineDrawV(void *displayData, int16_t x, int16_t y1,
+                                int16_t y2, uint16_t value)
+{
+    for(; y1 <= y2; y1++)
+    {
+        Graphics_offscreen4BppPixelDraw(displayData, x, y1, value);
+    }
+}
+
+//*****************************************************************************
+//
+//! Fills a rectangle on a 4 BPP off-screen image.
+//!
+//! \param displayData is a pointer to the image buffer.
+//! \param rect is a pointer to the structure containing the extents of the
+//! rectangle.
+//! \param value is the palette index of the rectangle.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void
+Graphics_offscreen4BppRectFill(void *displayData,
+                               const Graphics_Rectangle *rect, uint16_t value)
+{
+    int16_t y;
+
+    for(y = rect->yMin; y <= rect->yMax; y++)
+    {
+        Graphics_offscreen4BppLineDrawH(displayData, rect->xMin, rect->xMax, y,
+                                        value);
+    }
+}
+
+//*****************************************************************************
+//
+//! Translates a 24-bit RGB color to the nearest palette entry.
+//!
+//! \param displayData is a pointer to the image buffer.
+//! \param value is the 24-bit RGB color.
+//!
+//! \return Returns the index of the palette entry closest to the color.
+//
+//*****************************************************************************
+static uint32_t
+Graphics_offscreen4BppColorTranslate(void *displayData, uint32_t value)
+{
+    const uint8_t *palette = (const uint8_t *)displayData + OFFSCREEN_PALETTE;
+    int16_t red, green, blue;
+    uint32_t distance, best;
+    uint16_t index, match;
+
+    best = 0xffffffff;
+    match = 0;
+
+    for(index = 0; index < 16; index++, palette += 3)
+    {
+        blue = (int16_t)palette[0] - (int16_t)(value & 0xff);
+        green = (int16_t)palette[1] - (int16_t)((value >> 8) & 0xff);
+        red = (int16_t)palette[2] - (int16_t)((value >> 16) & 0xff);
+        distance = ((uint32_t)((int32_t)red * red) +
+                    (uint32_t)((int32_t)green * green) +
+                    (uint32_t)((int32_t)blue * blue));
+        if(distance < best)
+        {
+            best = distance;
+            match = index;
+        }
+    }
+
+    return(match);
+}
+
+//*****************************************************************************
+//
+//! Flushes any cached drawing operations; nothing is cached off-screen.
+//
+//*****************************************************************************
+static void
+Graphics_offscreen4BppFlush(void *displayData)
+{
+}
+
+//*****************************************************************************
+//
+//! Fills a 4 BPP off-screen image with one palette index.
+//
+//*****************************************************************************
+static void
+Graphics_offscreen4BppClearScreen(void *displayData, uint16_t value)
+{
+    uint8_t *data = displayData;
+    uint8_t *pixel = data + OFFSCREEN_PIXELS;
+    uint32_t count;
+
+    count = (uint32_t)((OFFSCREEN_WIDTH(data) + 1) / 2) *
+            (data[3] | ((uint16_t)data[4] << 8));
+    value &= 0x0f;
+
+    while(count--)
+    {
+        *pixel++ = (value << 4) | value;
+    }
+}
+
+//*****************************************************************************
+//
+//! Initializes a 4 BPP off-screen image.
+//!
+//! \param display is a pointer to the display structure to fill in.
+//! \param image is a pointer to the image buffer, at least
+//! Graphics_getOffscreen4BppImageSize() bytes.
+//! \param width is the width of the image in pixels.
+//! \param height is the height of the image in pixels.
+//!
+//! This function fills in a display structure that draws into the image
+//! buffer, so that a context initialized with it composes an image in
+//! memory.  Colors are matched to the nearest of the image's 16 palette
+//! entries, which should be set with Graphics_setOffscreen4BppPalette()
+//! before colors are chosen.  Whole-image draws go a row at a time through
+//! the pixel callback.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void Graphics_initOffscreen4BppImage(Graphics_Display *display,
+        uint8_t *image, int32_t width, int32_t height)
+{
+    image[0] = GRAPHICS_IMAGE_FMT_4BPP_UNCOMP;
+    image[1] = width & 0xff;
+    image[2] = width >> 8;
+    image[3] = height & 0xff;
+    image[4] = height >> 8;
+    image[5] = 16 - 1;
+
+    display->size = sizeof(Graphics_Display);
+    display->displayData = image;
+    display->width = width;
+    display->heigth = height;
+    display->callPixelDraw = Graphics_offscreen4BppPixelDraw;
+    display->callPixelDrawMultiple = Graphics_offscreen4BppPixelDrawMultiple;
+    display->callLineDrawH = Graphics_offscreen4BppLineDrawH;
+    display->callLineDrawV = Graphics_offscreen4BppLineDrawV;
+    display->callRectFill = Graphics_offscreen4BppRectFill;
+    display->callColorTranslate = Graphics_offscreen4BppColorTranslate;
+    display->callFlush = Graphics_offscreen4BppFlush;
+    display->callClearDisplay = Graphics_offscreen4BppClearScreen;
+    display->callImageBlit = 0;
+}
+
+//*****************************************************************************
+//
+//! Sets the palette of a 4 BPP off-screen image.
+//!
+//! \param display is a pointer to the display structure of the image.
+//! \param palette is a pointer to the 24-bit RGB colors to store.
+//! \param offset is the first palette entry to set.
+//! \param count is the number of palette entries to set.
+//!
+//! Pixels keep their palette indices, so pixels already drawn change color
+//! with the entries they use.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void Graphics_setOffscreen4BppPalette(Graphics_Display *display,
+        uint32_t *palette, uint32_t offset, uint32_t count)
+{
+    uint8_t *entry;
+
+    entry = (uint8_t *)display->displayData + OFFSCREEN_PALETTE + (offset * 3);
+
+    for(; count && (offset < 16); count--, offset++)
+    {
+        *entry++ = *palette & 0xff;
+        *entry++ = (*palette >> 8) & 0xff;
+        *entry++ = (*palette++ >> 16) & 0xff;
+    }
+}
+
+//*****************************************************************************
+//
+// Close the Doxygen group.
+//! @}
+//
+//*****************************************************************************
@@ -1,5 +1,6 @@
 
 #include "grlib.h"
+#include <string.h>
 
 //*****************************************************************************
 //
@@ -19,21 +20,504 @@
 
 //*****************************************************************************
 //
-// Counts the number of zeros at the start of a word.
+// The line buffer glyphs are rasterized into, 1 BPP.  Its stride depends on
+// the font height; a 8 pixel font gets a 128 pixel wide line.
 //
 //*****************************************************************************
-static int16_t Graphics_getNumberOfLeadingZeros(int32_t  x)
+#ifndef GRAPHICS_STRING_BUFFER
+#define GRAPHICS_STRING_BUFFER 128
+#endif
+
+static uint8_t g_pucStringLine[GRAPHICS_STRING_BUFFER];
+
+//*****************************************************************************
+//
+// The decoded glyph cache: the number of glyphs kept, least recently used
+// first out, and the bytes each may take.  A glyph of the 6x8 fixed font
+// takes 8.  A size of 0 leaves the cache out.
+//
+//*****************************************************************************
+#ifndef GRAPHICS_GLYPH_CACHE_SIZE
+#define GRAPHICS_GLYPH_CACHE_SIZE 16
+#endif
+
+#ifndef GRAPHICS_GLYPH_CACHE_BYTES
+#define GRAPHICS_GLYPH_CACHE_BYTES 8
+#endif
+
+//*****************************************************************************
+//
+// Reads the next run of a glyph: a number of off pixels followed by a number
+// of on pixels.  idx and bit track the position in the glyph data.  Returns
+// false once the data is used up.
+//
+//*****************************************************************************
+static bool Graphics_getGlyphRun(const uint8_t *data, bool compressed,
+		int32_t *idx, int32_t *bit, int32_t *off, int32_t *on)
 {
-  int32_t  y = 0x80, count =0;
-  int32_t  i;
-  for (i=0; i< 32; i++)
-  {
-    if (0x00 != (x & y ))
-      break;
-    count++;
-    y = y >> 1;
-  }    
-   return count;
+    uint8_t value;
+
+    if(*idx >= data[0])
+    {
+        return(false);
+    }
+
+    if(compressed)
+    {
+        //
+        // A byte of off and on counts, or a zero byte followed by a count
+        // of eight pixel groups, on if its top bit is set.
+        //
+        if(data[*idx])
+        {
+            *off = (data[*idx] >> 4) & 15;
+            *on = data[*idx] & 15;
+            *idx += 1;
+        }
+        else if(data[*idx + 1] & 0x80)
+        {
+            *off = 0;
+            *on = (data[*idx + 1] & 0x7f) * 8;
+            *idx += 2;
+        }
+        else
+        {
+            *off = data[*idx + 1] * 8;
+            *on = 0;
+            *idx += 2;
+        }
+        return(true);
+    }
+
+    //
+    // Uncompressed glyphs are a bit stream, most significant bit first.
+    // Count the clear bits, then the set ones.
+    //
+    for(*off = 0, *on = 0, value = 0; *idx < data[0]; )
+    {
+        value = (data[*idx] << *bit) & 0xFF;
+        if(value & 0x80)
+        {
+            break;
+        }
+        *off += 1;
+        if(++*bit == 8)
+        {
+            *bit = 0;
+            *idx += 1;
+        }
+    }
+    for(; *idx < data[0]; )
+    {
+        value = (data[*idx] << *bit) & 0xFF;
+        if(!(value & 0x80))
+        {
+            break;
+        }
+        *on += 1;
+        if(++*bit == 8)
+        {
+            *bit = 0;
+            *idx += 1;
+        }
+    }
+    return(true);
+}
+
+//*****************************************************************************
+//
+// Draws a horizontal or vertical run of glyph pixels, clipped.
+//
+//*****************************************************************************
+static void Graphics_drawGlyphSpan(Graphics_Context *context, int32_t x,
+		int32_t y, int32_t count, bool vertical, uint32_t color)
+{
+    context->foreground = color;
+
+    if(count > 1)
+    {
+        if(vertical)
+        {
+            Graphics_drawLineV(context, x, y, y + count - 1);
+        }
+        else
+        {
+            Graphics_drawLineH(context, x, x + count - 1, y);
+        }
+    }
+    else if((x >= context->clipRegion.xMin) &&
+            (x <= context->clipRegion.xMax) &&
+            (y >= context->clipRegion.yMin) &&
+            (y <= context->clipRegion.yMax))
+    {
+        Graphics_drawPixelOnDisplay(context->display, x, y, color);
+    }
+}
+
+//*****************************************************************************
+//
+// Draws a glyph run by run, as a line per run within each row.  This is used
+// for glyphs that do not fit the line buffer.
+//
+//*****************************************************************************
+static void Graphics_drawGlyphRuns(Graphics_Context *context,
+		const Graphics_Context *original, const uint8_t *data,
+		bool compressed, int32_t x, int32_t y, bool opaque)
+{
+    int32_t idx = 2, bit = 0, x0 = 0, y0 = 0;
+    int32_t off, on, count;
+
+    while(Graphics_getGlyphRun(data, compressed, &idx, &bit, &off, &on))
+    {
+        while(off || on)
+        {
+            if((y + y0) > context->clipRegion.yMax)
+            {
+                return;
+            }
+
+            count = off ? off : on;
+            if((x0 + count) > data[1])
+            {
+                count = data[1] - x0;
+            }
+
+            if(off)
+            {
+                if(opaque)
+                {
+                    Graphics_drawGlyphSpan(context, x + x0, y + y0, count,
+                            false, original->background);
+                }
+                off -= count;
+            }
+            else
+            {
+                Graphics_drawGlyphSpan(context, x + x0, y + y0, count, false,
+                        original->foreground);
+                on -= count;
+            }
+
+            x0 += count;
+            if(x0 == data[1])
+            {
+                x0 = 0;
+                y0++;
+            }
+        }
+    }
+}
+
+//*****************************************************************************
+//
+// Rasterizes a glyph into the line buffer at column x.  Every pixel the glyph
+// data covers is written, off or on.  Returns the number of pixels covered,
+// or -1 if the glyph has more than rows rows.
+//
+//*****************************************************************************
+static int32_t Graphics_rasterizeGlyph(const uint8_t *data, bool compressed,
+		int32_t x, int32_t stride, int32_t rows)
+{
+    int32_t idx = 2, bit = 0, x0 = 0, y0 = 0, pixels = 0;
+    int32_t off, on;
+    uint8_t *byte;
+    uint8_t mask;
+
+    while(Graphics_getGlyphRun(data, compressed, &idx, &bit, &off, &on))
+    {
+        for(pixels += off + on; off || on; )
+        {
+            if(y0 >= rows)
+            {
+                return(-1);
+            }
+
+            byte = &g_pucStringLine[(y0 * stride) + ((x + x0) >> 3)];
+            mask = 0x80 >> ((x + x0) & 7);
+            if(off)
+            {
+                *byte &= ~mask;
+                off--;
+            }
+            else
+            {
+                *byte |= mask;
+                on--;
+            }
+
+            if(++x0 == data[1])
+            {
+                x0 = 0;
+                y0++;
+            }
+        }
+    }
+
+    return(pixels);
+}
+
+#if GRAPHICS_GLYPH_CACHE_SIZE
+//*****************************************************************************
+//
+// A cached glyph: the pixels its data covers, decoded to rows of 1 BPP bytes,
+// most significant bit first, each row starting on a byte.
+//
+//*****************************************************************************
+typedef struct Graphics_CachedGlyph
+{
+    const Graphics_Font *font;
+    uint16_t stamp;         // the tick it was last used, 0 if unused
+    uint16_t pixels;        // the pixels its data covers
+    uint8_t code;
+    uint8_t width;
+    uint8_t bits[GRAPHICS_GLYPH_CACHE_BYTES];
+} Graphics_CachedGlyph;
+
+static Graphics_CachedGlyph g_psGlyphCache[GRAPHICS_GLYPH_CACHE_SIZE];
+static uint16_t g_usGlyphTick;
+static Graphics_GlyphCacheStats g_sGlyphCacheStats;
+
+//*****************************************************************************
+//
+// Advances the cache's clock.  When it wraps, the glyphs in use all restart
+// at the same age.
+//
+//*****************************************************************************
+static uint16_t Graphics_tickGlyphCache(void)
+{
+    Graphics_CachedGlyph *glyph;
+
+    if(!++g_usGlyphTick)
+    {
+        for(glyph = g_psGlyphCache;
+            glyph < &g_psGlyphCache[GRAPHICS_GLYPH_CACHE_SIZE]; glyph++)
+        {
+            glyph->stamp = glyph->stamp ? 1 : 0;
+        }
+        g_usGlyphTick = 2;
+    }
+
+    return(g_usGlyphTick);
+}
+
+//*****************************************************************************
+//
+// Copies a cached glyph into the line buffer at column x.  Only the glyph's
+// columns are written.
+//
+//*****************************************************************************
+static void Graphics_copyCachedGlyph(const Graphics_CachedGlyph *glyph,
+		int32_t x, int32_t stride)
+{
+    int32_t bytes = (glyph->width + 7) >> 3;
+    int32_t rows = (glyph->pixels + glyph->width - 1) / glyph->width;
+    int32_t shift = x & 7;
+    int32_t row, column, count;
+    const uint8_t *source = glyph->bits;
+    uint8_t *line;
+    uint8_t mask;
+
+    for(row = 0; row < rows; row++)
+    {
+        line = &g_pucStringLine[(row * stride) + (x >> 3)];
+        for(column = 0; column < bytes; column++, source++, line++)
+        {
+            count = glyph->width - (column * 8);
+            mask = (count >= 8) ? 0xFF : (uint8_t)(0xFF << (8 - count));
+            line[0] = (line[0] & ~(mask >> shift)) | (*source >> shift);
+            if(shift && ((count + shift) > 8))
+            {
+                line[1] = (line[1] & ~(uint8_t)(mask << (8 - shift))) |
+                          (uint8_t)(*source << (8 - shift));
+            }
+        }
+    }
+}
+
+//*****************************************************************************
+//
+// Decodes a glyph into the line buffer at column x through the cache: a hit
+// is copied from it, a miss is rasterized and then stored in place of the
+// least recently used glyph if it fits.  Returns as
+// Graphics_rasterizeGlyph() does.
+//
+//*****************************************************************************
+static int32_t Graphics_getCachedGlyph(const Graphics_Font *font,
+		uint8_t code, const uint8_t *data, bool compressed, int32_t x,
+		int32_t stride, int32_t rows)
+{
+    Graphics_CachedGlyph *glyph, *oldest;
+    int32_t pixels, bytes, i;
+
+    oldest = g_psGlyphCache;
+    for(glyph = g_psGlyphCache;
+        glyph < &g_psGlyphCache[GRAPHICS_GLYPH_CACHE_SIZE]; glyph++)
+    {
+        if(glyph->stamp && (glyph->font == font) && (glyph->code == code))
+        {
+            g_sGlyphCacheStats.hits++;
+            glyph->stamp = Graphics_tickGlyphCache();
+            Graphics_copyCachedGlyph(glyph, x, stride);
+            return(glyph->pixels);
+        }
+        if(glyph->stamp < oldest->stamp)
+        {
+            oldest = glyph;
+        }
+    }
+
+    g_sGlyphCacheStats.misses++;
+    pixels = Graphics_rasterizeGlyph(data, compressed, x, stride, rows);
+
+    //
+    // Keep it if its rows fit an entry.
+    //
+    bytes = (data[1] + 7) >> 3;
+    if((pixels <= 0) ||
+       ((((pixels + data[1] - 1) / data[1]) * bytes) >
+        GRAPHICS_GLYPH_CACHE_BYTES))
+    {
+        return(pixels);
+    }
+
+    oldest->font = font;
+    oldest->code = code;
+    oldest->width = data[1];
+    oldest->pixels = pixels;
+    oldest->stamp = Graphics_tickGlyphCache();
+    memset(oldest->bits, 0, GRAPHICS_GLYPH_CACHE_BYTES);
+    for(i = 0; i < pixels; i++)
+    {
+        if((g_pucStringLine[((i / data[1]) * stride) +
+                            ((x + (i % data[1])) >> 3)] <<
+            ((x + (i % data[1])) & 7)) & 0x80)
+        {
+            oldest->bits[((i / data[1]) * bytes) + ((i % data[1]) >> 3)] |=
+                0x80 >> ((i % data[1]) & 7);
+        }
+    }
+
+    return(pixels);
+}
+#endif
+
+//*****************************************************************************
+//
+// Sends a block of the line buffer as one clipped 1 BPP image, background
+// for clear bits and foreground for set ones.
+//
+//*****************************************************************************
+static void Graphics_blitGlyphs(const Graphics_Context *context,
+		int32_t x, int32_t y, int32_t lineX, int32_t lineY, int32_t width,
+		int32_t height, int32_t stride)
+{
+    uint32_t palette[2];
+    int32_t skip;
+
+    palette[0] = context->background;
+    palette[1] = context->foreground;
+
+    if(x < context->clipRegion.xMin)
+    {
+        skip = context->clipRegion.xMin - x;
+        x += skip;
+        lineX += skip;
+        width -= skip;
+    }
+    if((x + width - 1) > context->clipRegion.xMax)
+    {
+        width = context->clipRegion.xMax - x + 1;
+    }
+    if(y < context->clipRegion.yMin)
+    {
+        skip = context->clipRegion.yMin - y;
+        y += skip;
+        lineY += skip;
+        height -= skip;
+    }
+    if((y + height - 1) > context->clipRegion.yMax)
+    {
+        height = context->clipRegion.yMax - y + 1;
+    }
+    if((width <= 0) || (height <= 0))
+    {
+        return;
+    }
+
+    Graphics_blitImageOnDisplay(context->display, x, y, lineX & 7, width,
+            height, 1, &g_pucStringLine[(lineY * stride) + (lineX >> 3)],
+            stride, palette);
+}
+
+//*****************************************************************************
+//
+// Draws the set bits of a block of the line buffer in the foreground color,
+// as horizontal or vertical runs, whichever are fewer.
+//
+//*****************************************************************************
+static void Graphics_drawGlyphsTransparent(Graphics_Context *context,
+		const Graphics_Context *original, int32_t x, int32_t y,
+		int32_t width, int32_t height, int32_t stride)
+{
+    int32_t i, j, run, rows = 0, columns = 0;
+    bool vertical, set, last;
+
+#define GRAPHICS_LINE_BIT(col, row)                                          \
+        ((g_pucStringLine[((row) * stride) + ((col) >> 3)] >>                \
+          (7 - ((col) & 7))) & 1)
+
+    //
+    // Count the runs both ways.
+    //
+    for(j = 0; j < height; j++)
+    {
+        for(i = 0, last = false; i < width; i++)
+        {
+            set = GRAPHICS_LINE_BIT(i, j);
+            rows += (set && !last);
+            last = set;
+        }
+    }
+    for(i = 0; i < width; i++)
+    {
+        for(j = 0, last = false; j < height; j++)
+        {
+            set = GRAPHICS_LINE_BIT(i, j);
+            columns += (set && !last);
+            last = set;
+        }
+    }
+    vertical = columns < rows;
+
+    for(j = 0; j < (vertical ? width : height); j++)
+    {
+        for(i = 0, run = 0; i <= (vertical ? height : width); i++)
+        {
+            set = (i < (vertical ? height : width)) &&
+                  (vertical ? GRAPHICS_LINE_BIT(j, i) :
+                              GRAPHICS_LINE_BIT(i, j));
+            if(set)
+            {
+                run++;
+            }
+            else if(run)
+            {
+                if(vertical)
+                {
+                    Graphics_drawGlyphSpan(context, x + j, y + i - run, run,
+                            true, original->foreground);
+                }
+                else
+                {
+                    Graphics_drawGlyphSpan(context, x + i - run, y + j, run,
+                            false, original->foreground);
+                }
+                run = 0;
+            }
+        }
+    }
+
+#undef GRAPHICS_LINE_BIT
 }
 
 //*****************************************************************************
@@ -51,6 +535,10 @@ static int16_t Graphics_getNumberOfLeadingZeros(int32_t  x)
 //! located in flash); specifying a length of -1 will cause the width of the
 //! entire string to be computed.
 //!
+//! A font with the fixed-width flag set is measured by counting characters,
+//! and one with an advance width table by looking each one up in it; only
+//! fonts with neither are measured from their glyph data.
+//!
 //! \return Returns the width of the string in pixels.
 //
 //*****************************************************************************
@@ -59,7 +547,9 @@ int32_t Graphics_getStringWidth(const Graphics_Context *context,
 {
     const uint16_t *offset;
     const uint8_t *data;
+    const uint8_t *widths;
     uint8_t first, last, absent;
+    bool fixedWidth;
     int32_t  width;
 
     //
@@ -81,6 +571,8 @@ int32_t Graphics_getStringWidth(const Graphics_Context *context,
 
         data = font->data;
         offset = font->offset;
+        widths = font->widths;
+        fixedWidth = font->fixedWidth;
         first = font->first;
         last = font->last;
 
@@ -109,13 +601,42 @@ int32_t Graphics_getStringWidth(const Graphics_Context *context,
     {
         data = context->font->data;
         offset = context->font->offset;
+        widths = context->font->widths;
+        fixedWidth = context->font->fixedWidth;
         first = 32;
         last = 126;
         absent = GRAPHICS_ABSENT_CHAR_REPLACEMENT;
     }
 
     //
-    // Loop through the characters in the string.
+    // In a monospaced font the width is the number of characters times the
+    // width of one.
+    //
+    if(fixedWidth)
+    {
+        for(width = 0; *string && length; string++, length--)
+        {
+            width++;
+        }
+        return(width * context->font->maxWidth);
+    }
+
+    //
+    // With an advance width table, each character is a single lookup.
+    //
+    if(widths)
+    {
+        for(width = 0; *string && length; string++, length--)
+        {
+            width += widths[(((*string >= first) && (*string <= last)) ?
+                             *string : absent) - first];
+        }
+        return(width);
+    }
+
+    //
+    // Otherwise loop through the characters in the string, reading the
+    // width from the header of each glyph.
     //
     for(width = 0; *string && length; string++, length--)
     {
@@ -149,6 +670,27 @@ int32_t Graphics_getStringWidth(const Graphics_Context *context,
     return(width);
 }
 
+//*****************************************************************************
+//
+// Sends the characters buffered in the line buffer, lineX pixels wide.
+//
+//*****************************************************************************
+static void Graphics_flushGlyphs(Graphics_Context *context,
+		const Graphics_Context *original, int32_t x, int32_t y,
+		int32_t lineX, int32_t stride, bool opaque)
+{
+    if(opaque)
+    {
+        Graphics_blitGlyphs(original, x, y, 0, 0, lineX,
+                original->font->height, stride);
+    }
+    else
+    {
+        Graphics_drawGlyphsTransparent(context, original, x, y, lineX,
+                original->font->height, stride);
+    }
+}
+
 //*****************************************************************************
 //
 //! Draws a string.
@@ -161,8 +703,8 @@ int32_t Graphics_getStringWidth(const Graphics_Context *context,
 //! position on the screen.
 //! \param y is the Y coordinate of the upper left corner of the string
 //! position on the screen.
-//! \param opaque is true if the background of each character should be drawn
-//! and false if it should not (leaving the background as is).
+//! \param opaque is true if the background of each character cell should be
+//! drawn and false if it should not (leaving the background as is).
 //!
 //! This function draws a string of test on the screen.  The \e length
 //! parameter allows a portion of the string to be examined without having to
@@ -170,23 +712,28 @@ int32_t Graphics_getStringWidth(const Graphics_Context *context,
 //! if the string was located in flash); specifying a length of -1 will cause
 //! the entire string to be rendered (subject to clipping).
 //!
+//! The glyphs are rasterized side by side into a line buffer.  Opaque text
+//! is sent from it as one 1 BPP image, the full height of the character cell,
+//! so a line takes one address window with the foreground and background
+//! already interleaved; text drawn this way can overwrite the text under it
+//! without clearing first.  Transparent text only draws the set pixels, as
+//! horizontal or vertical lines, whichever takes fewer.
+//!
 //! \return None.
 //
 //*****************************************************************************
 void Graphics_drawString(const Graphics_Context *context, int8_t *string,
 		int32_t  length, int32_t  x, int32_t  y, bool  opaque)
 {
-    int32_t  idx, x0, y0, count, off, on, bit;
     const uint8_t *data;
     const uint8_t *glyphs;
     const uint16_t *offset;
-    uint8_t first, last, absent;
+    uint8_t first, last, absent, code;
+    bool compressed;
     Graphics_Context sContext;
+    int32_t stride, rows, pixels;
+    int32_t lineX = 0, lineStart = x;
 
-    int32_t  ySave = y;
-    y = 0;
-
-    
     //
     // Check the arguments.
     //
@@ -243,6 +790,15 @@ void Graphics_drawString(const Graphics_Context *context, int8_t *string,
         absent = GRAPHICS_ABSENT_CHAR_REPLACEMENT;
     }
 
+    compressed = (context->font->format & ~GRAPHICS_FONT_EX_MARKER) !=
+                 GRAPHICS_FONT_FMT_UNCOMPRESSED;
+
+    //
+    // The line buffer holds as many rows as the character cell.
+    //
+    rows = context->font->height;
+    stride = rows ? (GRAPHICS_STRING_BUFFER / rows) : 0;
+
     //
     // Loop through the characters in the string.
     //
@@ -264,12 +820,13 @@ void Graphics_drawString(const Graphics_Context *context, int8_t *string,
         //
         if((*string >= first) && (*string <= last))
         {
-            data = (glyphs + offset[*string - first]);
+            code = *string;
         }
         else
         {
-            data = (glyphs + offset[absent - first]);
+            code = absent;
         }
+        data = (glyphs + offset[code - first]);
         string++;
 
         //
@@ -289,409 +846,55 @@ void Graphics_drawString(const Graphics_Context *context, int8_t *string,
         }
 
         //
-        // Loop through the bytes in the encoded data for this glyph.
+        // Start a new block of characters when this one does not fit after
+        // the ones buffered.
         //
-        for(idx = 2, x0 = 0, bit = 0, y0 = 0; idx < data[0]; )
+        if(lineX && ((x != lineStart + lineX) ||
+                     ((lineX + data[1]) > (stride * 8))))
+        {
+            Graphics_flushGlyphs(&sContext, context, lineStart, y, lineX,
+                    stride, opaque);
+            lineX = 0;
+        }
+        if(!lineX)
         {
             //
-            // See if the bottom of the clipping region has been exceeded.
-            //
-            if((y + y0) > sContext.clipRegion.yMax)
-            {
-                //
-                // Stop drawing this character.
-                //
-                break;
-            }
-
-            //
-            // See if the font is uncompressed.
-            //
-            if((sContext.font->format & ~GRAPHICS_FONT_EX_MARKER) ==
-				GRAPHICS_FONT_FMT_UNCOMPRESSED)
-            {
-                //
-                // Count the number of off pixels from this position in the
-                // glyph image.
-                //
-                for(off = 0; idx < data[0]; )
-                {
-                    //
-                    // Get the number of zero pixels at this position.
-                    //
-                    count = Graphics_getNumberOfLeadingZeros(data[idx] << bit);
-
-                    //
-                    // If there were more than 8, then it is a "false" result
-                    // since it counted beyond the end of the current byte.
-                    // Therefore, simply limit it to the number of pixels
-                    // remaining in this byte.
-                    //
-                    if(count > 8)
-                    {
-                        count = 8 - bit;
-                    }
-
-                    //
-                    // Increment the number of off pixels.
-                    //
-                    off += count;
-
-                    //
-                    // Increment the bit position within the byte.
-                    //
-                    bit += count;
-
-                    //
-                    // See if the end of the byte has been reached.
-                    //
-                    if(bit == 8)
-                    {
-                        //
-                        // Advance to the next byte and continue counting off
-                        // pixels.
-                        //
-                        bit = 0;
-                        idx++;
-                    }
-                    else
-                    {
-                        //
-                        // Since the end of the byte was not reached, there
-                        // must be an on pixel.  Therefore, stop counting off
-                        // pixels.
-                        //
-                        break;
-                    }
-                }
-
-                //
-                // Count the number of on pixels from this position in the
-                // glyph image.
-                //
-                for(on = 0; idx < data[0]; )
-                {
-                    //
-                    // Get the number of one pixels at this location (by
-                    // inverting the data and counting the number of zeros).
-                    //
-                    count = Graphics_getNumberOfLeadingZeros(~(data[idx] << bit));
-                    
-
-                    //
-                    // If there were more than 8, then it is a "false" result
-                    // since it counted beyond the end of the current byte.
-                    // Therefore, simply limit it to the number of pixels
-                    // remaining in this byte.
-                    //
-                    if(count > 8)
-                    {
-                        count = 8 - bit;
-                    }
-
-                    //
-                    // Increment the number of on pixels.
-                    //
-                    on += count;
-
-                    //
-                    // Increment the bit position within the byte.
-                    //
-                    bit += count;
-
-                    //
-                    // See if the end of the byte has been reached.
-                    //
-                    if(bit == 8)
-                    {
-                        //
-                        // Advance to the next byte and continue counting on
-                        // pixels.
-                        //
-                        bit = 0;
-                        idx++;
-                    }
-                    else
-                    {
-                        //
-                        // Since the end of the byte was not reached, there
-                        // must be an off pixel.  Therefore, stop counting on
-                        // pixels.
-                        //
-                        break;
-                    }
-                }
-            }
-
-            //
-            // Otherwise, the font is compressed with a pixel RLE scheme.
-            //
-            else
-            {
-                //
-                // See if this is a byte that encodes some on and off pixels.
-                //
-                if(data[idx])
-                {
-                    //
-                    // Extract the number of off pixels.
-                    //
-                    off = (data[idx] >> 4) & 15;
-
-                    //
-                    // Extract the number of on pixels.
-                    //
-                    on = data[idx] & 15;
-
-                    //
-                    // Skip past this encoded byte.
-                    //
-                    idx++;
-                }
-
-                //
-                // Otherwise, see if this is a repeated on pixel byte.
-                //
-                else if(data[idx + 1] & 0x80)
-                {
-                    //
-                    // There are no off pixels in this encoding.
-                    //
-                    off = 0;
-
-                    //
-                    // Extract the number of on pixels.
-                    //
-                    on = (data[idx + 1] & 0x7f) * 8;
-
-                    //
-                    // Skip past these two encoded bytes.
-                    //
-                    idx += 2;
-                }
-
-                //
-                // Otherwise, this is a repeated off pixel byte.
-                //
-                else
-                {
-                    //
-                    // Extract the number of off pixels.
-                    //
-                    off = data[idx + 1] * 8;
-
-                    //
-                    // There are no on pixels in this encoding.
-                    //
-                    on = 0;
-
-                    //
-                    // Skip past these two encoded bytes.
-                    //
-                    idx += 2;
-                }
-            }
-
-            //
-            // Loop while there are any off pixels.
+            // Cell pixels the glyph data does not cover are background.
             //
-            while(off)
-            {
-                //
-                // See if the bottom of the clipping region has been exceeded.
-                //
-                if((y + y0) > sContext.clipRegion.yMax)
-                {
-                    //
-                    // Ignore the remainder of the on pixels.
-                    //
-                    break;
-                }
-
-                //
-                // See if there is more than one on pixel that will fit onto
-                // the current row.
-                //
-                if((off > 1) && ((x0 + 1) < data[1]))
-                {
-                    //
-                    // Determine the number of on pixels that will fit on this
-                    // row.
-                    //
-                    count = (((x0 + off) > data[1]) ? data[1] - x0 :
-                              off);
-
-                    //
-                    // If this row is within the clipping region, draw a
-                    // horizontal line that corresponds to the sequence of on
-                    // pixels.
-                    //
-                    if(((y + y0) >= sContext.clipRegion.yMin) && opaque)
-                    {
-                        sContext.foreground = context->background;
-                        Graphics_drawLineH(&sContext, x + x0, x + x0 + count - 1,
-                        		ySave + y + y0);
-                    }
-
-                    //
-                    // Decrement the count of on pixels by the number on this
-                    // row.
-                    //
-                    off -= count;
-
-                    //
-                    // Increment the X offset by the number of on pixels.
-                    //
-                    x0 += count;
-                }
-
-                //
-                // Otherwise, there is only a single on pixel that can be
-                // drawn.
-                //
-                else
-                {
-                    //
-                    // If this pixel is within the clipping region, then draw
-                    // it.
-                    //
-                    if(((x + x0) >= sContext.clipRegion.xMin) &&
-                       ((x + x0) <= sContext.clipRegion.xMax) &&
-                       ((y + y0) >= sContext.clipRegion.yMin) && opaque)
-                    {
-                       Graphics_drawPixelOnDisplay(context->display, x + x0, ySave + y + y0,
-                                     context->background);
-                    }
-
-                    //
-                    // Decrement the count of on pixels.
-                    //
-                    off--;
-
-                    //
-                    // Increment the X offset.
-                    //
-                    x0++;
-                }
+            lineStart = x;
+            memset(g_pucStringLine, 0, GRAPHICS_STRING_BUFFER);
+        }
 
-                //
-                // See if the X offset has reached the right side of the
-                // character glyph.
-                //
-                if(x0 == data[1])
-                {
-                    //
-                    // Increment the Y offset.
-                    //
-                    y0++;
-
-                    //
-                    // Reset the X offset to the left side of the character
-                    // glyph.
-                    //
-                    x0 = 0;
-                }
-            }
+        pixels = -1;
+        if(data[1] <= (stride * 8))
+        {
+#if GRAPHICS_GLYPH_CACHE_SIZE
+            pixels = Graphics_getCachedGlyph(context->font, code, data,
+                    compressed, lineX, stride, rows);
+#else
+            pixels = Graphics_rasterizeGlyph(data, compressed, lineX, stride,
+                    rows);
+#endif
+        }
 
+        if(pixels < 0)
+        {
             //
-            // Loop while there are any on pixels.
+            // Too large for the line buffer; send what is buffered and draw
+            // this one run by run.
             //
-            while(on)
+            if(lineX)
             {
-                //
-                // See if the bottom of the clipping region has been exceeded.
-                //
-                if((y + y0) > sContext.clipRegion.yMax)
-                {
-                    //
-                    // Ignore the remainder of the on pixels.
-                    //
-                    break;
-                }
-
-                //
-                // See if there is more than one on pixel that will fit onto
-                // the current row.
-                //
-                if((on > 1) && ((x0 + 1) < data[1]))
-                {
-                    //
-                    // Determine the number of on pixels that will fit on this
-                    // row.
-                    //
-                    count = (((x0 + on) > data[1]) ? data[1] - x0 :
-                              on);
-
-                    //
-                    // If this row is within the clipping region, draw a
-                    // horizontal line that corresponds to the sequence of on
-                    // pixels.
-                    //
-                    if((y + y0) >= sContext.clipRegion.yMin)
-                    {
-                        sContext.foreground = context->foreground;
-                        Graphics_drawLineH(&sContext, x + x0, x + x0 + count - 1,
-                        		ySave + y + y0);
-                        
-                    }
-
-                    //
-                    // Decrement the count of on pixels by the number on this
-                    // row.
-                    //
-                    on -= count;
-
-                    //
-                    // Increment the X offset by the number of on pixels.
-                    //
-                    x0 += count;
-                }
-
-                //
-                // Otherwise, there is only a single on pixel that can be
-                // drawn.
-                //
-                else
-                {
-                    //
-                    // If this pixel is within the clipping region, then draw
-                    // it.
-                    //
-                    if(((x + x0) >= sContext.clipRegion.xMin) &&
-                       ((x + x0) <= sContext.clipRegion.xMax) &&
-                       ((y + y0) >= sContext.clipRegion.yMin))
-                    	Graphics_drawPixelOnDisplay(context->display, x + x0, ySave + y + y0,
-                                     context->foreground);
-          
-                    //
-                    // Decrement the count of on pixels.
-                    //
-                    on--;
-
-                    //
-                    // Increment the X offset.
-                    //
-                    x0++;
-                }
-
-                //
-                // See if the X offset has reached the right side of the
-                // character glyph.
-                //
-                if(x0 == data[1])
-                {
-                    //
-                    // Increment the Y offset.
-                    //
-                    y0++;
-
-                    //
-                    // Reset the X offset to the left side of the character
-                    // glyph.
-                    //
-                    x0 = 0;
-                }
+                Graphics_flushGlyphs(&sContext, context, lineStart, y, lineX,
+                        stride, opaque);
+                lineX = 0;
             }
+            Graphics_drawGlyphRuns(&sContext, context, data, compressed, x, y,
+                    opaque);
+        }
+        else
+        {
+            lineX += data[1];
         }
 
         //
@@ -699,6 +902,12 @@ void Graphics_drawString(const Graphics_Context *context, int8_t *string,
         //
         x += data[1];
     }
+
+    if(lineX)
+    {
+        Graphics_flushGlyphs(&sContext, context, lineStart, y, lineX,
+                stride, opaque);
+    }
 }
 
 //*****************************************************************************
@@ -749,10 +958,41 @@ void  Graphics_drawStringCentered(const Graphics_Context *context,
 		int8_t *string, int32_t  length, int32_t  x, int32_t  y,
 		bool  opaque)
 {
-	Graphics_drawString(context, string, length,
-			(x) - (Graphics_getStringWidth(context, string, length) / 2),
-			(y) - (context->font->baseline / 2), opaque);
+	Graphics_drawStringCenteredWidth(context, string, length, x, y, opaque,
+			Graphics_getStringWidth(context, string, length));
+}
 
+//*****************************************************************************
+//
+//! Draws a centered string of known width.
+//!
+//! \param context is a pointer to the drawing context to use.
+//! \param string is a pointer to the string to be drawn.
+//! \param length is the number of characters from the string that should be
+//! drawn on the screen.
+//! \param x is the X coordinate of the center of the string position on the
+//! screen.
+//! \param y is the Y coordinate of the center of the string position on the
+//! screen.
+//! \param opaque is \b true if the background of each character should be
+//! drawn and \b false if it should not (leaving the background as is).
+//! \param width is the width of the string in the context's font, as
+//! Graphics_getStringWidth() would return it.
+//!
+//! This function draws a string as Graphics_drawStringCentered() does, but
+//! takes its width instead of measuring it.  The width of a constant string
+//! can be worked out at build time, so drawing it centered then needs no
+//! pass over its characters besides the one that draws them.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void Graphics_drawStringCenteredWidth(const Graphics_Context *context,
+		int8_t *string, int32_t  length, int32_t  x, int32_t  y,
+		bool  opaque, int32_t  width)
+{
+	Graphics_drawString(context, string, length, (x) - (width / 2),
+			(y) - (context->font->baseline / 2), opaque);
 }
 
 
@@ -798,6 +1038,49 @@ uint8_t Graphics_getStringMaxWidth(const Graphics_Context *context)
 }
 
 
+//*****************************************************************************
+//
+//! Gets the decoded glyph cache counters.
+//!
+//! Graphics_drawString() keeps the most recently drawn glyphs decoded, keyed
+//! by font and character, so strings drawn again need not decode the font
+//! data.  This function returns how many glyphs were found in the cache and
+//! how many had to be decoded since the cache was last cleared.  Both stay
+//! zero if the cache is compiled out with a \b GRAPHICS_GLYPH_CACHE_SIZE of
+//! 0.
+//!
+//! \return Returns a pointer to the counters.
+//
+//*****************************************************************************
+const Graphics_GlyphCacheStats *Graphics_getGlyphCacheStats(void)
+{
+#if GRAPHICS_GLYPH_CACHE_SIZE
+    return(&g_sGlyphCacheStats);
+#else
+    static const Graphics_GlyphCacheStats sNone;
+
+    return(&sNone);
+#endif
+}
+
+//*****************************************************************************
+//
+//! Empties the decoded glyph cache.
+//!
+//! This function drops every glyph in the cache and zeroes its counters.  It
+//! is only needed if the data of a font in use is changed in place.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void Graphics_clearGlyphCache(void)
+{
+#if GRAPHICS_GLYPH_CACHE_SIZE
+    memset(g_psGlyphCache, 0, sizeof(g_psGlyphCache));
+    memset(&g_sGlyphCacheStats, 0, sizeof(g_sGlyphCacheStats));
+    g_usGlyphTick = 0;
+#endif
+}
 
 //*****************************************************************************
 //
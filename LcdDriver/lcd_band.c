@@ -0,0 +1,249 @@
+// lcd_band.c
+// Banded variant of the Crystalfontz128x128 display driver.
+//
+// The whole panel is opened as one address window with one RAMWR, and the
+// screen is then produced band by band from the top.  Drawing goes into the
+// band buffer in the panel's byte order, rows relative to the band's first
+// row; grlib clips everything else away.  While one buffer is being drawn
+// the other is on its way to the panel by DMA, so a band costs the longer
+// of its rendering and its transfer rather than their sum.
+
+#include "Grlib/grlib/grlib.h"
+#include "LcdDriver/lcd_band.h"
+#include "LcdDriver/lcd_driver.h"
+#include "LcdDriver/lcd_rowstore.h"
+#include "LcdDriver/lower_driver.h"
+#include <stdint.h>
+
+#define LCD_ROW_BYTES       HAL_LCD_PIXEL_BYTES(LCD_HORIZONTAL_MAX)
+#define LCD_BAND_BYTES      (LCD_BAND_ROWS * LCD_ROW_BYTES)
+
+//*****************************************************************************
+//
+// The two band buffers, 2 KB together with the default four rows (1.5 KB in
+// 12-bit mode).  They are in FRAM like the framebuffer, since the part has
+// only 2 KB of RAM; the DMA reads them from there just as well.
+//
+//*****************************************************************************
+#pragma PERSISTENT(Lcd_BandBuffer)
+static uint8_t Lcd_BandBuffer[2][LCD_BAND_ROWS][LCD_ROW_BYTES] = { { { 0 } } };
+
+// The buffer being drawn, and the panel row of its first row.
+static uint8_t (*Lcd_Band)[LCD_ROW_BYTES];
+static int16_t Lcd_BandY;
+
+static Lcd_BandStats Lcd_BandCounters;
+
+static void Crystalfontz128x128_BandFillSpan(int16_t lY, int16_t lX1,
+                                             int16_t lX2, uint16_t ulValue)
+{
+    uint8_t *row = Lcd_Band[lY - Lcd_BandY];
+
+    for (; lX1 <= lX2; lX1++)
+    {
+        Crystalfontz128x128_StorePixel(row, lX1, ulValue);
+    }
+}
+
+static void Crystalfontz128x128_BandPixelDraw(void *pvDisplayData,
+                                              int16_t lX, int16_t lY,
+                                              uint16_t ulValue)
+{
+    Crystalfontz128x128_StorePixel(Lcd_Band[lY - Lcd_BandY], lX, ulValue);
+}
+
+//*****************************************************************************
+//
+// Draws a horizontal sequence of pixels into the band.  The palette
+// conventions are those of Crystalfontz128x128_PixelDrawMultiple().
+//
+//*****************************************************************************
+static void Crystalfontz128x128_BandPixelDrawMultiple(void *pvDisplayData,
+                                                      int16_t lX, int16_t lY,
+                                                      int16_t lX0,
+                                                      int16_t lCount,
+                                                      int16_t lBPP,
+                                                      const uint8_t *pucData,
+                                                      const uint32_t *pucPalette)
+{
+    Crystalfontz128x128_StorePixels(Lcd_Band[lY - Lcd_BandY], lX, lX0, lCount,
+                                    lBPP, pucData, pucPalette);
+}
+
+static void Crystalfontz128x128_BandImageBlit(void *pvDisplayData,
+                                              int16_t lX, int16_t lY,
+                                              int16_t lX0, int16_t lWidth,
+                                              int16_t lHeight, int16_t lBPP,
+                                              const uint8_t *pucData,
+                                              int16_t lStride,
+                                              const uint32_t *pucPalette)
+{
+    while (lHeight--)
+    {
+        Crystalfontz128x128_BandPixelDrawMultiple(pvDisplayData, lX, lY++,
+                                                  lX0, lWidth, lBPP,
+                                                  pucData, pucPalette);
+        pucData += lStride;
+    }
+}
+
+static void Crystalfontz128x128_BandLineDrawH(void *pvDisplayData,
+                                              int16_t lX1, int16_t lX2,
+                                              int16_t lY, uint16_t ulValue)
+{
+    Crystalfontz128x128_BandFillSpan(lY, lX1, lX2, ulValue);
+}
+
+static void Crystalfontz128x128_BandLineDrawV(void *pvDisplayData,
+                                              int16_t lX, int16_t lY1,
+                                              int16_t lY2, uint16_t ulValue)
+{
+    for (; lY1 <= lY2; lY1++)
+    {
+        Crystalfontz128x128_StorePixel(Lcd_Band[lY1 - Lcd_BandY], lX, ulValue);
+    }
+}
+
+static void Crystalfontz128x128_BandRectFill(void *pvDisplayData,
+                                             const Graphics_Rectangle *pRect,
+                                             uint16_t ulValue)
+{
+    int16_t lY;
+
+    for (lY = pRect->sYMin; lY <= pRect->sYMax; lY++)
+    {
+        Crystalfontz128x128_BandFillSpan(lY, pRect->sXMin, pRect->sXMax,
+                                         ulValue);
+    }
+}
+
+static uint32_t Crystalfontz128x128_BandColorTranslate(void *pvDisplayData,
+                                                       uint32_t ulValue)
+{
+    return g_sCrystalfontz128x128.callColorTranslate(pvDisplayData, ulValue);
+}
+
+// Bands are sent by Crystalfontz128x128_BandRender(); there is nothing to do.
+static void Crystalfontz128x128_BandFlush(void *pvDisplayData)
+{
+}
+
+//*****************************************************************************
+//
+// Graphics_clearDisplay() ignores the clip region; only the band is cleared.
+//
+//*****************************************************************************
+static void Crystalfontz128x128_BandClearScreen(void *pvDisplayData,
+                                                uint16_t ulValue)
+{
+    Graphics_Rectangle rect = { 0, Lcd_BandY, LCD_HORIZONTAL_MAX - 1,
+                                Lcd_BandY + LCD_BAND_ROWS - 1 };
+
+    Crystalfontz128x128_BandRectFill(pvDisplayData, &rect, ulValue);
+}
+
+//*****************************************************************************
+//
+//! Draws a whole screen band by band.
+//!
+//! \param context is a drawing context initialized with
+//! g_sCrystalfontz128x128_Banded.
+//! \param draw is the function that draws the screen.
+//!
+//! The panel is opened as one address window, then draw is called once per
+//! band with the context clipped to the band.  Each band is sent by DMA as
+//! soon as it is drawn, and the next one is drawn into the other buffer in
+//! the meantime.  The panel is never shown a partly drawn band, and rows are
+//! replaced in order from the top, so the update does not flicker.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void Crystalfontz128x128_BandRender(Graphics_Context *context,
+                                    Lcd_BandDraw draw)
+{
+    Graphics_Rectangle saved = context->clipRegion;
+    Graphics_Rectangle band;
+    uint8_t index = 0;
+
+    Crystalfontz128x128_SetDrawFrame(0, 0, LCD_HORIZONTAL_MAX - 1,
+                                     LCD_VERTICAL_MAX - 1);
+    HAL_LCD_writeCommand(CM_RAMWR);
+
+    band.xMin = 0;
+    band.xMax = LCD_HORIZONTAL_MAX - 1;
+
+    for (Lcd_BandY = 0; Lcd_BandY < LCD_VERTICAL_MAX;
+         Lcd_BandY += LCD_BAND_ROWS)
+    {
+        //
+        // The last transfer from this buffer finished before the other one
+        // was started.
+        //
+        Lcd_Band = Lcd_BandBuffer[index];
+        Crystalfontz128x128_BandClearScreen(0, context->background);
+
+        band.yMin = Lcd_BandY;
+        band.yMax = Lcd_BandY + LCD_BAND_ROWS - 1;
+        Graphics_setClipRegion(context, &band);
+        draw(context);
+
+        if (HAL_LCD_dmaBusy())
+        {
+            Lcd_BandCounters.overlapped++;
+        }
+        HAL_LCD_dmaWriteData(Lcd_Band[0], LCD_BAND_BYTES, 0);
+        Lcd_BandCounters.bands++;
+        index ^= 1;
+    }
+
+    HAL_LCD_dmaWait();
+    Graphics_setClipRegion(context, &saved);
+    Lcd_BandCounters.frames++;
+    Crystalfontz128x128_DisplayOn();
+}
+
+//*****************************************************************************
+//
+//! Returns the memory taken by the two band buffers, in bytes.
+//
+//*****************************************************************************
+uint16_t Crystalfontz128x128_GetBandBytes(void)
+{
+    return sizeof(Lcd_BandBuffer);
+}
+
+const Lcd_BandStats *Crystalfontz128x128_GetBandStats(void)
+{
+    return &Lcd_BandCounters;
+}
+
+void Crystalfontz128x128_ClearBandStats(void)
+{
+    Lcd_BandCounters.frames = 0;
+    Lcd_BandCounters.bands = 0;
+    Lcd_BandCounters.overlapped = 0;
+}
+
+//*****************************************************************************
+//
+//! The display structure for the banded driver.  Drawing through it only
+//! makes sense from a Crystalfontz128x128_BandRender() callback.
+//
+//*****************************************************************************
+const Graphics_Display g_sCrystalfontz128x128_Banded =
+{
+    sizeof(tDisplay),
+    0,
+    LCD_VERTICAL_MAX,
+    LCD_HORIZONTAL_MAX,
+    Crystalfontz128x128_BandPixelDraw,
+    Crystalfontz128x128_BandPixelDrawMultiple,
+    Crystalfontz128x128_BandLineDrawH,
+    Crystalfontz128x128_BandLineDrawV,
+    Crystalfontz128x128_BandRectFill,
+    Crystalfontz128x128_BandColorTranslate,
+    Crystalfontz128x128_BandFlush,
+    Crystalfontz128x128_BandClearScreen,
+    Crystalfontz128x128_BandImageBlit
+};
@@ -0,0 +1,49 @@
+// lcd_band.h
+// Banded variant of the Crystalfontz128x128 display driver, for full-screen
+// updates without a framebuffer.  A screen is described by a draw callback,
+// which is run once per band of LCD_BAND_ROWS rows; each band is rendered
+// into one of two small buffers while the other is sent to the panel.
+
+#ifndef LCD_BAND_H_
+#define LCD_BAND_H_
+
+#include <stdint.h>
+#include "Grlib/grlib/grlib.h"
+
+#ifndef LCD_BAND_ROWS
+#define LCD_BAND_ROWS       4       // must divide 128
+#endif
+
+//*****************************************************************************
+//
+// Draws the whole screen.  The context is clipped to the band being
+// rendered, which has already been filled with the background color, so the
+// callback does not need to clear it.
+//
+//*****************************************************************************
+typedef void (*Lcd_BandDraw)(Graphics_Context *context);
+
+//*****************************************************************************
+//
+// Band statistics, cumulative until cleared.
+//
+//*****************************************************************************
+typedef struct Lcd_BandStats
+{
+    uint16_t frames;        // calls to Crystalfontz128x128_BandRender()
+    uint32_t bands;         // bands rendered and sent
+    uint32_t overlapped;    // ...rendered while the previous one was sent
+} Lcd_BandStats;
+
+extern const Graphics_Display g_sCrystalfontz128x128_Banded;
+
+extern void Crystalfontz128x128_BandRender(Graphics_Context *context,
+                                           Lcd_BandDraw draw);
+
+extern uint16_t Crystalfontz128x128_GetBandBytes(void);
+
+extern const Lcd_BandStats *Crystalfontz128x128_GetBandStats(void);
+
+extern void Crystalfontz128x128_ClearBandStats(void);
+
+#endif // LCD_BAND_H_
@@ -11,149 +11,1044 @@ uint16_t Lcd_ScreenWidth, Lcd_ScreenHeigth;
 uint8_t Lcd_PenSolid, Lcd_FontSolid, Lcd_FlagRead;
 uint16_t Lcd_TouchTrim;
 
+// Pixels converted from a palette per burst in PixelDrawMultiple.
+#define LCD_PIXEL_CHUNK     32
+
+// Runs shorter than this are cheaper to send from the CPU than to set up a
+// DMA transfer for.
+#define LCD_DMA_MIN_PIXELS  16
+
+//*****************************************************************************
+//
+// Ping-pong line buffers for PixelDrawMultiple, in the panel's byte order.
+// One is sent by DMA while the next chunk is converted into the other, so
+// they must outlive the call that filled them.
+//
+//*****************************************************************************
+static uint8_t Lcd_LineBuffer[2][HAL_LCD_PIXEL_BYTES(LCD_PIXEL_CHUNK)];
+static uint8_t Lcd_LineIndex;
+static uint16_t Lcd_LineQueued;
+
+//*****************************************************************************
+//
+// The address window last sent to the panel, in panel coordinates, so that
+// an unchanged CASET or RASET can be left out.  Lcd_RunOpen is set while the
+// RAMWR opened by PixelDraw is still accepting pixels, with the write pointer
+// at (Lcd_RunX, Lcd_RunY).
+//
+//*****************************************************************************
+static uint16_t Lcd_WindowX0, Lcd_WindowX1, Lcd_WindowY0, Lcd_WindowY1;
+static uint8_t Lcd_WindowValid;
+static uint8_t Lcd_RunOpen;
+static int16_t Lcd_RunX, Lcd_RunY;
+
+#ifdef LCD_COLOR_12BIT
+// The blue nibble of the last pixel of an open run, held back when it shares
+// its byte with the next pixel.
+static uint8_t Lcd_RunNibble;
+static uint8_t Lcd_RunHalf;
+#endif
+
+static Lcd_WindowStats Lcd_WindowCounters;
+
+//*****************************************************************************
+//
+// Vertical scrolling works on the gate lines of the controller's frame
+// memory.  The panel shows lines 1 to 128; the line holding screen row (or
+// column, with MV) 0 depends on the orientation.
+//
+//*****************************************************************************
+#define LCD_SCROLL_LINES    132
+#define LCD_SCROLL_FIRST    1
+
+// Top fixed area and height of the scroll area, in gate lines.
+static uint16_t Lcd_ScrollFixed;
+static uint16_t Lcd_ScrollHeight;
+
+//*****************************************************************************
+//
+// Sends count pixels of one color, by DMA when the run is long enough.
+//
+//*****************************************************************************
+static void Crystalfontz128x128_WriteRepeat(uint16_t color, uint16_t count)
+{
+    if (count >= LCD_DMA_MIN_PIXELS)
+    {
+        HAL_LCD_dmaFillColor(color, count, 0);
+    }
+    else
+    {
+        HAL_LCD_writeColorRepeat(color, count);
+    }
+}
+
+//*****************************************************************************
+//
+// Sends the pixels queued in the current line buffer and switches to the
+// other one.
+//
+//*****************************************************************************
+static void Crystalfontz128x128_SendLine(void)
+{
+    if (Lcd_LineQueued == 0)
+    {
+        return;
+    }
+
+    if (Lcd_LineQueued >= LCD_DMA_MIN_PIXELS)
+    {
+        HAL_LCD_dmaWriteData(Lcd_LineBuffer[Lcd_LineIndex],
+                             HAL_LCD_PIXEL_BYTES(Lcd_LineQueued), 0);
+    }
+    else
+    {
+        HAL_LCD_writeDataBurst(Lcd_LineBuffer[Lcd_LineIndex],
+                               HAL_LCD_PIXEL_BYTES(Lcd_LineQueued));
+    }
+
+    Lcd_LineIndex ^= 1;
+    Lcd_LineQueued = 0;
+}
+
+//*****************************************************************************
+//
+// Appends one pixel to the current line buffer, sending it when full.  In
+// 12-bit mode an odd pixel completes the byte its predecessor started; the
+// chunk size is even, so only the last send of a RAMWR can end half way.
+//
+//*****************************************************************************
+static void Crystalfontz128x128_QueuePixel(uint16_t color)
+{
+#ifdef LCD_COLOR_12BIT
+    uint8_t *pixel = &Lcd_LineBuffer[Lcd_LineIndex][(Lcd_LineQueued >> 1) * 3];
+
+    if (Lcd_LineQueued & 1)
+    {
+        pixel[1] |= (color >> 8) & 0x0F;
+        pixel[2] = color;
+    }
+    else
+    {
+        pixel[0] = color >> 4;
+        pixel[1] = color << 4;
+    }
+#else
+    uint8_t *pixel = &Lcd_LineBuffer[Lcd_LineIndex][Lcd_LineQueued * 2];
+
+    pixel[0] = color >> 8;
+    pixel[1] = color;
+#endif
+
+    if (++Lcd_LineQueued == LCD_PIXEL_CHUNK)
+    {
+        Crystalfontz128x128_SendLine();
+    }
+}
+
+//*****************************************************************************
+//
+// Timing.  Timer_A1 runs free at SMCLK/64 (4 us at 16 MHz) from the start of
+// initialization; a 16-bit difference of two readings covers at most 262 ms.
+// Lcd_DisplayPending is set while the panel is still dark after boot.
+//
+//*****************************************************************************
+#define LCD_TICK_US         4
+#define LCD_TICKS_PER_MS    (1000 / LCD_TICK_US)
+
+static uint8_t Lcd_DisplayPending;
+static uint16_t Lcd_BootStart;
+static uint32_t Lcd_BootTime;
+
+//*****************************************************************************
+//
+// Power management.  Lcd_IdleTicks counts the time since the last activity,
+// accumulated from Timer_A1 by every poll.  Lcd_FrameDrawn is set by
+// Crystalfontz128x128_SetDrawFrame(), so a flush can tell whether anything
+// was drawn since the last one.  The partial area is kept in gate lines.
+//
+//*****************************************************************************
+#define LCD_SLPOUT_CYCLES   1920000     // 120 ms after SLPOUT
+#define LCD_SLPIN_CYCLES    80000       // 5 ms after SLPIN
+
+#define LCD_DIM_FADE_MS     1000        // fade down when dimming
+#define LCD_WAKE_FADE_MS    100         // fade back up on activity
+
+static uint8_t Lcd_PowerState;
+static uint8_t Lcd_Backlight;
+static uint8_t Lcd_BacklightDim;
+static uint8_t Lcd_PartialOn;
+static uint8_t Lcd_PartialSet;
+static uint16_t Lcd_PartialStart, Lcd_PartialEnd;
+static uint8_t Lcd_FrameDrawn;
+static uint16_t Lcd_IdleLast;
+static uint32_t Lcd_IdleTicks;
+static uint32_t Lcd_IdleTimeout[LCD_POWER_STATES];
+static Lcd_PowerStats Lcd_PowerCounters;
+
+//*****************************************************************************
+//
+// Resets the ST7735 and brings it out of sleep with the display still off.
+// Frame memory is left as the controller powered up with.
+//
+//*****************************************************************************
+static void Crystalfontz128x128_InitController(void)
+{
+    TA1EX0 = TAIDEX_7;
+    TA1CTL = TASSEL__SMCLK | ID__8 | MC__CONTINUOUS;
+    Lcd_BootStart = TA1R;
+
+    HAL_LCD_PortInit();
+    HAL_LCD_SpiInit();
+    Crystalfontz128x128_InvalidateWindow();
+
+    // Reset pulse
+    P9OUT &= ~BIT4;             // Reset pin low
+    __delay_cycles(2*200);
+    P9OUT |= BIT4;              // Reset pin high
+    __delay_cycles(2*480);
+
+    HAL_LCD_writeCommand(CM_SLPOUT);
+    __delay_cycles(200);
+
+    HAL_LCD_writeCommand(CM_GAMSET);
+    HAL_LCD_writeData(0x04);
+
+    HAL_LCD_writeCommand(CM_SETPWCTR);
+    HAL_LCD_writeData(0x0A);
+    HAL_LCD_writeData(0x14);
+
+    HAL_LCD_writeCommand(CM_SETSTBA);
+    HAL_LCD_writeData(0x0A);
+    HAL_LCD_writeData(0x00);
+
+    HAL_LCD_writeCommand(CM_COLMOD);
+    HAL_LCD_writeData(CM_COLMOD_FORMAT);
+    __delay_cycles(10);
+
+    HAL_LCD_writeCommand(CM_MADCTL);
+    HAL_LCD_writeData(CM_MADCTL_BGR);
+
+    HAL_LCD_writeCommand(CM_NORON);
+
+    Lcd_ScreenWidth  = LCD_VERTICAL_MAX;
+    Lcd_ScreenHeigth = LCD_HORIZONTAL_MAX;
+    Lcd_PenSolid  = 0;
+    Lcd_FontSolid = 1;
+    Lcd_FlagRead  = 0;
+    Lcd_TouchTrim = 0;
+
+    Lcd_DisplayPending = 1;
+    Lcd_PowerState = LCD_POWER_ACTIVE;
+    Lcd_PartialOn = 0;
+    Lcd_PartialSet = 0;
+    Lcd_FrameDrawn = 0;
+}
+
+//*****************************************************************************
+//
+// Fills a rectangle of frame memory with a native color.  Empty rectangles
+// are ignored.
+//
+//*****************************************************************************
+static void Crystalfontz128x128_FillFrame(int16_t x0, int16_t y0,
+                                          int16_t x1, int16_t y1,
+                                          uint16_t color)
+{
+    if ((x1 < x0) || (y1 < y0))
+    {
+        return;
+    }
+
+    Crystalfontz128x128_SetDrawFrame(x0, y0, x1, y1);
+    HAL_LCD_writeCommand(CM_RAMWR);
+    HAL_LCD_dmaFillColor(color, (uint16_t)(x1 - x0 + 1) * (y1 - y0 + 1), 0);
+}
+
 //*****************************************************************************
 //
 //! Initializes the display driver.
 //!
 //! This function initializes the ST7735 display controller on the panel,
-//! preparing it to display data.
+//! clears it to white and switches it on.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void Crystalfontz128x128_Init(void)
+{
+    Crystalfontz128x128_InitColor(GRAPHICS_COLOR_WHITE);
+    Crystalfontz128x128_DisplayOn();
+}
+
+//*****************************************************************************
+//
+//! Initializes the display driver, leaving the panel dark.
+//!
+//! \param ulColor is the 24-bit RGB color to fill frame memory with, or
+//! \b LCD_INIT_NO_FILL to leave it as it is.
+//!
+//! The panel stays in DISPOFF until the first Graphics_flushBuffer(), so the
+//! first screen is drawn over ulColor out of sight and nothing has to clear
+//! the panel again before it.  LCD_INIT_NO_FILL suits a framebuffer, whose
+//! first flush sends every row anyway.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void Crystalfontz128x128_InitColor(uint32_t ulColor)
+{
+    Crystalfontz128x128_InitController();
+
+    if (ulColor != LCD_INIT_NO_FILL)
+    {
+        Crystalfontz128x128_FillFrame(0, 0, LCD_HORIZONTAL_MAX - 1,
+                                      LCD_VERTICAL_MAX - 1,
+            g_sCrystalfontz128x128.callColorTranslate(0, ulColor));
+    }
+}
+
+//*****************************************************************************
+//
+//! Initializes the display driver with a splash image.
+//!
+//! \param pImage is the image to show, centered on the panel.
+//! \param ulBackground is the 24-bit RGB color around the image.
+//!
+//! The image is drawn in the orientation set in Lcd_Orientation, and every
+//! pixel of frame memory is written once before the panel is switched on.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void Crystalfontz128x128_InitSplash(const Graphics_Image *pImage,
+                                    uint32_t ulBackground)
+{
+    Graphics_Context context;
+    uint16_t color;
+    int16_t x0, y0, x1, y1;
+
+    Crystalfontz128x128_InitController();
+    Crystalfontz128x128_SetOrientation(Lcd_Orientation);
+
+    color = g_sCrystalfontz128x128.callColorTranslate(0, ulBackground);
+    x0 = (LCD_HORIZONTAL_MAX - pImage->xSize) / 2;
+    y0 = (LCD_VERTICAL_MAX - pImage->ySize) / 2;
+    x1 = x0 + pImage->xSize - 1;
+    y1 = y0 + pImage->ySize - 1;
+
+    Crystalfontz128x128_FillFrame(0, 0, LCD_HORIZONTAL_MAX - 1, y0 - 1, color);
+    Crystalfontz128x128_FillFrame(0, y1 + 1, LCD_HORIZONTAL_MAX - 1,
+                                  LCD_VERTICAL_MAX - 1, color);
+    Crystalfontz128x128_FillFrame(0, y0, x0 - 1, y1, color);
+    Crystalfontz128x128_FillFrame(x1 + 1, y0, LCD_HORIZONTAL_MAX - 1, y1,
+                                  color);
+
+    Graphics_initContext(&context, &g_sCrystalfontz128x128);
+    Graphics_drawImage(&context, pImage, x0, y0);
+    Graphics_flushBuffer(&context);
+}
+
+//*****************************************************************************
+//
+//! Shows what has been drawn.
+//!
+//! The drivers' flush callbacks call this.  After
+//! Crystalfontz128x128_InitColor() it switches the panel on, so the first
+//! screen appears whole, and keeps the time since initialization started for
+//! Crystalfontz128x128_GetBootTime().  Afterwards, if anything was drawn
+//! since the last call, it wakes the panel from power saving, drops the
+//! partial area and restarts the idle timer.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void Crystalfontz128x128_DisplayOn(void)
+{
+    if (Lcd_DisplayPending)
+    {
+        __delay_cycles(10);
+        HAL_LCD_writeCommand(CM_DISPON);
+        Lcd_DisplayPending = 0;
+        Lcd_FrameDrawn = 0;
+
+        Lcd_BootTime = (uint32_t)(uint16_t)(TA1R - Lcd_BootStart) * LCD_TICK_US;
+        Crystalfontz128x128_PowerWake();
+        return;
+    }
+
+    if (Lcd_FrameDrawn)
+    {
+        Lcd_FrameDrawn = 0;
+        Lcd_PartialSet = 0;
+        Crystalfontz128x128_PowerWake();
+    }
+}
+
+//*****************************************************************************
+//
+//! Returns the time from the start of initialization to the panel being
+//! switched on, in microseconds.
+//
+//*****************************************************************************
+uint32_t Crystalfontz128x128_GetBootTime(void)
+{
+    return Lcd_BootTime;
+}
+
+
+//*****************************************************************************
+//
+// Ends an open PixelDraw run, sending the nibble it may still be holding.
+//
+//*****************************************************************************
+static void Crystalfontz128x128_CloseRun(void)
+{
+#ifdef LCD_COLOR_12BIT
+    if (Lcd_RunHalf)
+    {
+        Lcd_RunHalf = 0;
+        HAL_LCD_writeData(Lcd_RunNibble << 4);
+    }
+#endif
+    Lcd_RunOpen = 0;
+}
+
+
+void Crystalfontz128x128_SetDrawFrame(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1)
+{
+    // Whatever the caller sends next ends an open PixelDraw run.
+    Crystalfontz128x128_CloseRun();
+    Lcd_WindowCounters.windows++;
+    Lcd_FrameDrawn = 1;
+
+    switch (Lcd_Orientation) {
+        case 0:
+            x0 += 2;
+            y0 += 3;
+            x1 += 2;
+            y1 += 3;
+            break;
+        case 1:
+            x0 += 3;
+            y0 += 2;
+            x1 += 3;
+            y1 += 2;
+            break;
+        case 2:
+            x0 += 2;
+            y0 += 1;
+            x1 += 2;
+            y1 += 1;
+            break;
+        case 3:
+            x0 += 1;
+            y0 += 2;
+            x1 += 1;
+            y1 += 2;
+            break;
+        default:
+            break;
+    }
+
+    if (Lcd_WindowValid && (x0 == Lcd_WindowX0) && (x1 == Lcd_WindowX1))
+    {
+        Lcd_WindowCounters.casetSkipped++;
+    }
+    else
+    {
+        HAL_LCD_writeCommand(CM_CASET);
+        HAL_LCD_writeData((uint8_t)(x0 >> 8));
+        HAL_LCD_writeData((uint8_t)(x0));
+        HAL_LCD_writeData((uint8_t)(x1 >> 8));
+        HAL_LCD_writeData((uint8_t)(x1));
+        Lcd_WindowX0 = x0;
+        Lcd_WindowX1 = x1;
+    }
+
+    if (Lcd_WindowValid && (y0 == Lcd_WindowY0) && (y1 == Lcd_WindowY1))
+    {
+        Lcd_WindowCounters.rasetSkipped++;
+    }
+    else
+    {
+        HAL_LCD_writeCommand(CM_RASET);
+        HAL_LCD_writeData((uint8_t)(y0 >> 8));
+        HAL_LCD_writeData((uint8_t)(y0));
+        HAL_LCD_writeData((uint8_t)(y1 >> 8));
+        HAL_LCD_writeData((uint8_t)(y1));
+        Lcd_WindowY0 = y0;
+        Lcd_WindowY1 = y1;
+    }
+
+    Lcd_WindowValid = 1;
+}
+
+
+//*****************************************************************************
+//
+//! Forgets the cached address window and any open pixel run.
+//!
+//! Code that sends commands to the panel without going through
+//! Crystalfontz128x128_SetDrawFrame(), or that resets the controller, must
+//! call this so that the next window is sent in full.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void Crystalfontz128x128_InvalidateWindow(void)
+{
+    Crystalfontz128x128_CloseRun();
+    Lcd_WindowValid = 0;
+}
+
+
+const Lcd_WindowStats *Crystalfontz128x128_GetWindowStats(void)
+{
+    return &Lcd_WindowCounters;
+}
+
+
+void Crystalfontz128x128_ClearWindowStats(void)
+{
+    Lcd_WindowCounters.pixelDraws = 0;
+    Lcd_WindowCounters.coalesced = 0;
+    Lcd_WindowCounters.windows = 0;
+    Lcd_WindowCounters.casetSkipped = 0;
+    Lcd_WindowCounters.rasetSkipped = 0;
+}
+
+
+//*****************************************************************************
+//
+//! Sets the LCD Orientation.
+//!
+//! \param orientation is the desired orientation for the LCD. Valid values are:
+//!           - \b LCD_ORIENTATION_UP,
+//!           - \b LCD_ORIENTATION_LEFT,
+//!           - \b LCD_ORIENTATION_DOWN,
+//!           - \b LCD_ORIENTATION_RIGHT,
+//!
+//! This function sets the orientation of the LCD
+//!
+//! \return None.
+//
+//*****************************************************************************
+void Crystalfontz128x128_SetOrientation(uint8_t orientation)
+{
+    Lcd_Orientation = orientation;
+    Crystalfontz128x128_InvalidateWindow();
+    HAL_LCD_writeCommand(CM_MADCTL);
+    switch (Lcd_Orientation) {
+        case LCD_ORIENTATION_UP:
+            HAL_LCD_writeData(CM_MADCTL_MX | CM_MADCTL_MY | CM_MADCTL_BGR);
+            break;
+        case LCD_ORIENTATION_LEFT:
+            HAL_LCD_writeData(CM_MADCTL_MY | CM_MADCTL_MV | CM_MADCTL_BGR);
+            break;
+        case LCD_ORIENTATION_DOWN:
+            HAL_LCD_writeData(CM_MADCTL_BGR);
+            break;
+        case LCD_ORIENTATION_RIGHT:
+            HAL_LCD_writeData(CM_MADCTL_MX | CM_MADCTL_MV | CM_MADCTL_BGR);
+            break;
+    }
+}
+
+
+//*****************************************************************************
+//
+// Whether screen coordinates run against the gate lines.  With
+// LCD_ORIENTATION_UP and LEFT, screen row (column) 0 is the last line shown.
+//
+//*****************************************************************************
+static uint8_t Crystalfontz128x128_ScrollMirrored(void)
+{
+    return (Lcd_Orientation == LCD_ORIENTATION_UP) ||
+           (Lcd_Orientation == LCD_ORIENTATION_LEFT);
+}
+
+
+//*****************************************************************************
+//
+//! Defines the area moved by hardware scrolling.
+//!
+//! \param top is the number of screen rows at the top that stay in place.
+//! \param bottom is the number of screen rows at the bottom that stay in
+//! place.
+//!
+//! The rows in between form the scroll area, whose contents can then be
+//! moved with Crystalfontz128x128_SetScrollOffset() without being sent
+//! again.  The scroll area runs along the screen's Y axis for
+//! LCD_ORIENTATION_UP and DOWN, and along its X axis for LEFT and RIGHT, in
+//! which case top and bottom count columns from the left and right.  The
+//! offset is reset to 0.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void Crystalfontz128x128_SetScrollArea(uint16_t top, uint16_t bottom)
+{
+    uint16_t tfa, bfa;
+
+    Lcd_ScrollHeight = LCD_VERTICAL_MAX - top - bottom;
+    if (Crystalfontz128x128_ScrollMirrored())
+    {
+        tfa = LCD_SCROLL_FIRST + bottom;
+        bfa = LCD_SCROLL_LINES - LCD_SCROLL_FIRST - LCD_VERTICAL_MAX + top;
+    }
+    else
+    {
+        tfa = LCD_SCROLL_FIRST + top;
+        bfa = LCD_SCROLL_LINES - LCD_SCROLL_FIRST - LCD_VERTICAL_MAX + bottom;
+    }
+    Lcd_ScrollFixed = tfa;
+
+    Crystalfontz128x128_CloseRun();
+    HAL_LCD_writeCommand(CM_SCRLAR);
+    HAL_LCD_writeData((uint8_t)(tfa >> 8));
+    HAL_LCD_writeData((uint8_t)(tfa));
+    HAL_LCD_writeData((uint8_t)(Lcd_ScrollHeight >> 8));
+    HAL_LCD_writeData((uint8_t)(Lcd_ScrollHeight));
+    HAL_LCD_writeData((uint8_t)(bfa >> 8));
+    HAL_LCD_writeData((uint8_t)(bfa));
+
+    Crystalfontz128x128_SetScrollOffset(0);
+}
+
+
+//*****************************************************************************
+//
+//! Scrolls the contents of the scroll area.
+//!
+//! \param offset is the number of rows the contents are moved up (towards
+//! the top fixed area), modulo the height of the scroll area.
+//!
+//! Rows scrolled out at the top come back in at the bottom: the first row of
+//! the scroll area shows what was drawn offset rows below it.  Drawing still
+//! uses the unscrolled coordinates.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void Crystalfontz128x128_SetScrollOffset(uint16_t offset)
+{
+    uint16_t start;
+
+    offset %= Lcd_ScrollHeight;
+    if (Crystalfontz128x128_ScrollMirrored() && offset)
+    {
+        offset = Lcd_ScrollHeight - offset;
+    }
+    start = Lcd_ScrollFixed + offset;
+
+    Crystalfontz128x128_CloseRun();
+    HAL_LCD_writeCommand(CM_VSCSAD);
+    HAL_LCD_writeData((uint8_t)(start >> 8));
+    HAL_LCD_writeData((uint8_t)(start));
+}
+
+
+//*****************************************************************************
+//
+//! Leaves scroll mode.
+//!
+//! The panel shows its memory unscrolled again, so anything drawn while the
+//! offset was not 0 appears where it was drawn.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void Crystalfontz128x128_ScrollOff(void)
+{
+    Crystalfontz128x128_CloseRun();
+    HAL_LCD_writeCommand(CM_NORON);
+}
+
+
+//*****************************************************************************
+//
+//! Sets the backlight brightness.
+//!
+//! \param percent is the brightness, 0 to 100, when the display is active.
+//!
+//! The display returns to this brightness whenever it wakes; in the power
+//! saving states the backlight is dimmed or off instead.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void Crystalfontz128x128_SetBacklight(uint8_t percent)
+{
+    Crystalfontz128x128_FadeBacklight(percent, 0);
+}
+
+
+//*****************************************************************************
+//
+//! Fades the backlight to a new brightness.
+//!
+//! \param percent is the brightness, 0 to 100, when the display is active.
+//! \param ms is the length of the fade in milliseconds.
+//!
+//! The fade runs from the timer interrupt; this function returns at once.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void Crystalfontz128x128_FadeBacklight(uint8_t percent, uint16_t ms)
+{
+    Lcd_Backlight = percent;
+    if (Lcd_PowerState == LCD_POWER_ACTIVE)
+    {
+        HAL_LCD_fadeBacklight(percent, ms);
+    }
+}
+
+
+//*****************************************************************************
+//
+//! Sets the brightness the backlight fades to in LCD_POWER_DIM and
+//! LCD_POWER_PARTIAL.
+//!
+//! \param percent is the brightness, 0 to 100.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void Crystalfontz128x128_SetDimBacklight(uint8_t percent)
+{
+    Lcd_BacklightDim = percent;
+}
+
+
+//*****************************************************************************
+//
+//! Sets the rows shown in LCD_POWER_PARTIAL.
+//!
+//! \param y0 is the first screen row to keep.
+//! \param y1 is the last screen row to keep.
+//!
+//! Like the scroll area, the rows run along the screen's Y axis for
+//! LCD_ORIENTATION_UP and DOWN and along its X axis for LEFT and RIGHT.  The
+//! idle timer only enters LCD_POWER_PARTIAL while an area is set; drawing
+//! something and flushing it drops the area again.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void Crystalfontz128x128_SetPartialArea(uint16_t y0, uint16_t y1)
+{
+    if (Crystalfontz128x128_ScrollMirrored())
+    {
+        Lcd_PartialStart = LCD_SCROLL_FIRST + LCD_VERTICAL_MAX - 1 - y1;
+        Lcd_PartialEnd = LCD_SCROLL_FIRST + LCD_VERTICAL_MAX - 1 - y0;
+    }
+    else
+    {
+        Lcd_PartialStart = LCD_SCROLL_FIRST + y0;
+        Lcd_PartialEnd = LCD_SCROLL_FIRST + y1;
+    }
+    Lcd_PartialSet = 1;
+}
+
+
+//*****************************************************************************
+//
+//! Sets how long the display must be idle before entering a power state.
+//!
+//! \param state is LCD_POWER_DIM, LCD_POWER_PARTIAL, LCD_POWER_OFF or
+//! LCD_POWER_SLEEP.
+//! \param ms is the idle time in milliseconds, or 0 to never enter it.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void Crystalfontz128x128_SetIdleTimeout(uint8_t state, uint16_t ms)
+{
+    Lcd_IdleTimeout[state] = (uint32_t)ms * LCD_TICKS_PER_MS;
+}
+
+
+//*****************************************************************************
+//
+//! Puts the display into a power state.
+//!
+//! \param state is one of the LCD_POWER_* states.
+//!
+//! Frame memory is kept in every state, so going back to LCD_POWER_ACTIVE
+//! shows the same screen without redrawing it.  Waking from
+//! LCD_POWER_SLEEP waits the 120 ms the controller needs after SLPOUT, and
+//! entering it waits 5 ms after SLPIN.  Drawing is possible in every state.
+//! Partial mode ends scroll mode.  The time taken, including those waits,
+//! is kept in the power statistics; backlight fades run on in the
+//! background and are not part of it.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void Crystalfontz128x128_PowerEnter(uint8_t state)
+{
+    uint8_t old = Lcd_PowerState;
+    uint8_t level;
+    uint16_t start;
+    uint32_t elapsed;
+
+    if (state == old)
+    {
+        return;
+    }
+
+    start = TA1R;
+    Crystalfontz128x128_CloseRun();
+
+    if (old == LCD_POWER_SLEEP)
+    {
+        HAL_LCD_writeCommand(CM_SLPOUT);
+        HAL_LCD_txFlush();
+        __delay_cycles(LCD_SLPOUT_CYCLES);
+    }
+
+    if ((state == LCD_POWER_PARTIAL) && !Lcd_PartialOn)
+    {
+        HAL_LCD_writeCommand(CM_PTLAR);
+        HAL_LCD_writeData((uint8_t)(Lcd_PartialStart >> 8));
+        HAL_LCD_writeData((uint8_t)(Lcd_PartialStart));
+        HAL_LCD_writeData((uint8_t)(Lcd_PartialEnd >> 8));
+        HAL_LCD_writeData((uint8_t)(Lcd_PartialEnd));
+        HAL_LCD_writeCommand(CM_PTLON);
+        Lcd_PartialOn = 1;
+    }
+    else if ((state < LCD_POWER_PARTIAL) && Lcd_PartialOn)
+    {
+        HAL_LCD_writeCommand(CM_NORON);
+        Lcd_PartialOn = 0;
+    }
+
+    if (state >= LCD_POWER_OFF)
+    {
+        if (old < LCD_POWER_OFF)
+        {
+            HAL_LCD_setBacklight(0);
+            HAL_LCD_writeCommand(CM_DISPOFF);
+        }
+    }
+    else
+    {
+        level = (state == LCD_POWER_ACTIVE) ? Lcd_Backlight : Lcd_BacklightDim;
+        if (old >= LCD_POWER_OFF)
+        {
+            HAL_LCD_writeCommand(CM_DISPON);
+            HAL_LCD_setBacklight(level);
+        }
+        else
+        {
+            HAL_LCD_fadeBacklight(level, (state == LCD_POWER_ACTIVE) ?
+                                         LCD_WAKE_FADE_MS : LCD_DIM_FADE_MS);
+        }
+    }
+
+    if (state == LCD_POWER_SLEEP)
+    {
+        HAL_LCD_writeCommand(CM_SLPIN);
+        HAL_LCD_txFlush();
+        __delay_cycles(LCD_SLPIN_CYCLES);
+    }
+
+    HAL_LCD_txFlush();
+    elapsed = (uint32_t)(uint16_t)(TA1R - start) * LCD_TICK_US;
+
+    Lcd_PowerCounters.entries[state]++;
+    if (state > old)
+    {
+        Lcd_PowerCounters.enterTime[state] = elapsed;
+    }
+    else
+    {
+        Lcd_PowerCounters.exitTime[old] = elapsed;
+    }
+    Lcd_PowerState = state;
+}
+
+
+//*****************************************************************************
+//
+//! Records activity: restarts the idle timer and brings the display back to
+//! LCD_POWER_ACTIVE.
 //!
-//! \return None.
+//! \return Returns the power state the display was in, LCD_POWER_ACTIVE if
+//! it was already awake.
 //
 //*****************************************************************************
-void Crystalfontz128x128_Init(void)
+uint8_t Crystalfontz128x128_PowerWake(void)
 {
-    HAL_LCD_PortInit();
-    HAL_LCD_SpiInit();
-
-    // Reset pulse
-    P9OUT &= ~BIT4;             // Reset pin low
-    __delay_cycles(2*200);
-    P9OUT |= BIT4;              // Reset pin high
-    __delay_cycles(2*480);
-
-    HAL_LCD_writeCommand(CM_SLPOUT);
-    __delay_cycles(200);
-
-    HAL_LCD_writeCommand(CM_GAMSET);
-    HAL_LCD_writeData(0x04);
+    uint8_t old = Lcd_PowerState;
 
-    HAL_LCD_writeCommand(CM_SETPWCTR);
-    HAL_LCD_writeData(0x0A);
-    HAL_LCD_writeData(0x14);
+    Lcd_IdleTicks = 0;
+    Lcd_IdleLast = TA1R;
+    Crystalfontz128x128_PowerEnter(LCD_POWER_ACTIVE);
 
-    HAL_LCD_writeCommand(CM_SETSTBA);
-    HAL_LCD_writeData(0x0A);
-    HAL_LCD_writeData(0x00);
+    return old;
+}
 
-    HAL_LCD_writeCommand(CM_COLMOD);
-    HAL_LCD_writeData(0x05);
-    __delay_cycles(10);
 
-    HAL_LCD_writeCommand(CM_MADCTL);
-    HAL_LCD_writeData(CM_MADCTL_BGR);
+//*****************************************************************************
+//
+//! Advances the idle timer and enters the deepest power state whose timeout
+//! has passed.
+//!
+//! Call this from wait loops, at least every 262 ms; a longer gap loses
+//! idle time but does no other harm.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void Crystalfontz128x128_PowerPoll(void)
+{
+    uint16_t now = TA1R;
+    uint8_t state, target = Lcd_PowerState;
 
-    HAL_LCD_writeCommand(CM_NORON);
+    Lcd_IdleTicks += (uint16_t)(now - Lcd_IdleLast);
+    Lcd_IdleLast = now;
 
-    Lcd_ScreenWidth  = LCD_VERTICAL_MAX;
-    Lcd_ScreenHeigth = LCD_HORIZONTAL_MAX;
-    Lcd_PenSolid  = 0;
-    Lcd_FontSolid = 1;
-    Lcd_FlagRead  = 0;
-    Lcd_TouchTrim = 0;
+    for (state = Lcd_PowerState + 1; state < LCD_POWER_STATES; state++)
+    {
+        if (Lcd_IdleTimeout[state] && (Lcd_IdleTicks >= Lcd_IdleTimeout[state]) &&
+            ((state != LCD_POWER_PARTIAL) || Lcd_PartialSet))
+        {
+            target = state;
+        }
+    }
 
-    Crystalfontz128x128_SetDrawFrame(0, 0, 127, 127);
-    HAL_LCD_writeCommand(CM_RAMWR);
-    int i;
-    for (i = 0; i < 16384; i++)
+    if (target != Lcd_PowerState)
     {
-        HAL_LCD_writeData(0xFF);
-        HAL_LCD_writeData(0xFF);
+        Crystalfontz128x128_PowerEnter(target);
     }
+}
 
-    __delay_cycles(10);
-    HAL_LCD_writeCommand(CM_DISPON);
+
+uint8_t Crystalfontz128x128_GetPowerState(void)
+{
+    return Lcd_PowerState;
 }
 
 
-void Crystalfontz128x128_SetDrawFrame(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1)
+const Lcd_PowerStats *Crystalfontz128x128_GetPowerStats(void)
 {
-    switch (Lcd_Orientation) {
-        case 0:
-            x0 += 2;
-            y0 += 3;
-            x1 += 2;
-            y1 += 3;
-            break;
-        case 1:
-            x0 += 3;
-            y0 += 2;
-            x1 += 3;
-            y1 += 2;
-            break;
-        case 2:
-            x0 += 2;
-            y0 += 1;
-            x1 += 2;
-            y1 += 1;
-            break;
-        case 3:
-            x0 += 1;
-            y0 += 2;
-            x1 += 1;
-            y1 += 2;
-            break;
-        default:
-            break;
-    }
+    return &Lcd_PowerCounters;
+}
+
 
-    HAL_LCD_writeCommand(CM_CASET);
-    HAL_LCD_writeData((uint8_t)(x0 >> 8));
-    HAL_LCD_writeData((uint8_t)(x0));
-    HAL_LCD_writeData((uint8_t)(x1 >> 8));
-    HAL_LCD_writeData((uint8_t)(x1));
+void Crystalfontz128x128_ClearPowerStats(void)
+{
+    uint8_t state;
 
-    HAL_LCD_writeCommand(CM_RASET);
-    HAL_LCD_writeData((uint8_t)(y0 >> 8));
-    HAL_LCD_writeData((uint8_t)(y0));
-    HAL_LCD_writeData((uint8_t)(y1 >> 8));
-    HAL_LCD_writeData((uint8_t)(y1));
+    for (state = 0; state < LCD_POWER_STATES; state++)
+    {
+        Lcd_PowerCounters.entries[state] = 0;
+        Lcd_PowerCounters.enterTime[state] = 0;
+        Lcd_PowerCounters.exitTime[state] = 0;
+    }
 }
 
+//*****************************************************************************
+//
+// The palette of the last offscreen image sent, in panel colors.  It lives
+// in FRAM so the 1 KB needed for an 8 BPP image does not come out of RAM.
+//
+//*****************************************************************************
+#pragma PERSISTENT(Lcd_BlitPalette)
+static uint32_t Lcd_BlitPalette[256] = { 0 };
 
 //*****************************************************************************
 //
-//! Sets the LCD Orientation.
+//! Sends an offscreen image to the panel.
 //!
-//! \param orientation is the desired orientation for the LCD. Valid values are:
-//!           - \b LCD_ORIENTATION_UP,
-//!           - \b LCD_ORIENTATION_LEFT,
-//!           - \b LCD_ORIENTATION_DOWN,
-//!           - \b LCD_ORIENTATION_RIGHT,
+//! \param pOffscreen is the display set up by Graphics_initOffscreen1BppImage(),
+//! Graphics_initOffscreen4BppImage() or Graphics_initOffscreen8BppImage().
+//! \param lX is the X coordinate of the left edge of the image on the panel.
+//! \param lY is the Y coordinate of the top edge of the image on the panel.
 //!
-//! This function sets the orientation of the LCD
+//! The image's palette is translated once, and the part of the image on the
+//! panel is sent in one address window and one RAMWR.  A 128x128 screen
+//! composed at 4 BPP takes 8 KB instead of the 32 KB of a framebuffer.  The
+//! image goes straight to the panel, past any framebuffer.
 //!
 //! \return None.
 //
 //*****************************************************************************
-void Crystalfontz128x128_SetOrientation(uint8_t orientation)
+void Crystalfontz128x128_BlitOffscreen(const Graphics_Display *pOffscreen,
+                                       int16_t lX, int16_t lY)
 {
-    Lcd_Orientation = orientation;
-    HAL_LCD_writeCommand(CM_MADCTL);
-    switch (Lcd_Orientation) {
-        case LCD_ORIENTATION_UP:
-            HAL_LCD_writeData(CM_MADCTL_MX | CM_MADCTL_MY | CM_MADCTL_BGR);
-            break;
-        case LCD_ORIENTATION_LEFT:
-            HAL_LCD_writeData(CM_MADCTL_MY | CM_MADCTL_MV | CM_MADCTL_BGR);
-            break;
-        case LCD_ORIENTATION_DOWN:
-            HAL_LCD_writeData(CM_MADCTL_BGR);
-            break;
-        case LCD_ORIENTATION_RIGHT:
-            HAL_LCD_writeData(CM_MADCTL_MX | CM_MADCTL_MV | CM_MADCTL_BGR);
-            break;
+    const uint8_t *pucImage = pOffscreen->displayData;
+    const uint8_t *pucData;
+    int16_t lBPP, lWidth, lHeight, lStride, lX0, lSkip;
+    uint16_t uColors, uIndex;
+
+    lBPP = pucImage[0] & 0x0f;
+    lWidth = pucImage[1] | ((uint16_t)pucImage[2] << 8);
+    lHeight = pucImage[3] | ((uint16_t)pucImage[4] << 8);
+
+    if (lBPP == 1)
+    {
+        Lcd_BlitPalette[0] =
+            g_sCrystalfontz128x128.callColorTranslate(0, 0x000000);
+        Lcd_BlitPalette[1] =
+            g_sCrystalfontz128x128.callColorTranslate(0, 0xFFFFFF);
+        pucData = pucImage + 5;
+        lStride = (lWidth + 7) / 8;
+    }
+    else
+    {
+        uColors = pucImage[5] + 1;
+        pucData = pucImage + 6;
+        for (uIndex = 0; uIndex < uColors; uIndex++, pucData += 3)
+        {
+            Lcd_BlitPalette[uIndex] =
+                g_sCrystalfontz128x128.callColorTranslate(0,
+                    pucData[0] | ((uint32_t)pucData[1] << 8) |
+                    ((uint32_t)pucData[2] << 16));
+        }
+        lStride = (lBPP == 4) ? ((lWidth + 1) / 2) : lWidth;
+    }
+
+    //
+    // Clip to the panel.  Rows above it are skipped; columns left of it are
+    // skipped in whole bytes plus a sub-byte offset.
+    //
+    if (lY < 0)
+    {
+        pucData += (int32_t)lStride * -lY;
+        lHeight += lY;
+        lY = 0;
+    }
+    if (lY + lHeight > Lcd_ScreenHeigth)
+    {
+        lHeight = Lcd_ScreenHeigth - lY;
     }
+
+    lX0 = 0;
+    if (lX < 0)
+    {
+        lSkip = -lX;
+        pucData += (lSkip * lBPP) / 8;
+        lX0 = (lSkip * lBPP) % 8 / lBPP;
+        lWidth += lX;
+        lX = 0;
+    }
+    if (lX + lWidth > Lcd_ScreenWidth)
+    {
+        lWidth = Lcd_ScreenWidth - lX;
+    }
+
+    if ((lWidth <= 0) || (lHeight <= 0))
+    {
+        return;
+    }
+
+    Graphics_blitImageOnDisplay(&g_sCrystalfontz128x128, lX, lY, lX0, lWidth,
+                                lHeight, lBPP, pucData, lStride,
+                                Lcd_BlitPalette);
+    Graphics_flushOnDisplay(&g_sCrystalfontz128x128);
 }
 
 
@@ -170,64 +1065,72 @@ void Crystalfontz128x128_SetOrientation(uint8_t orientation)
 //! This function sets the given pixel to a particular color.  The coordinates
 //! of the pixel are assumed to be within the extents of the display.
 //!
+//! The window is opened from the pixel to the right edge of its row, so a
+//! following call for the next pixel along only has to send the color.  In
+//! 12-bit mode the last nibble of every other pixel waits for the next one;
+//! it is sent when the run is closed by the next window or a flush.
+//!
 //! \return None.
 //
 //*****************************************************************************
 static void Crystalfontz128x128_PixelDraw(void *pvDisplayData, int16_t lX, int16_t lY,
                                    uint16_t ulValue)
 {
+    Lcd_WindowCounters.pixelDraws++;
 
-    Crystalfontz128x128_SetDrawFrame(lX,lY,lX,lY);
+    if (Lcd_RunOpen && (lX == Lcd_RunX) && (lY == Lcd_RunY))
+    {
+        Lcd_WindowCounters.coalesced++;
+    }
+    else
+    {
+        Crystalfontz128x128_SetDrawFrame(lX, lY, LCD_HORIZONTAL_MAX - 1, lY);
+        HAL_LCD_writeCommand(CM_RAMWR);
+        Lcd_RunOpen = 1;
+        Lcd_RunY = lY;
+    }
+    Lcd_RunX = lX + 1;
 
     //
     // Write the pixel value.
     //
-    HAL_LCD_writeCommand(CM_RAMWR);
+#ifdef LCD_COLOR_12BIT
+    if (Lcd_RunHalf)
+    {
+        HAL_LCD_writeData((Lcd_RunNibble << 4) | ((ulValue >> 8) & 0x0F));
+        HAL_LCD_writeData(ulValue);
+        Lcd_RunHalf = 0;
+    }
+    else
+    {
+        HAL_LCD_writeData(ulValue >> 4);
+        Lcd_RunNibble = ulValue & 0x0F;
+        Lcd_RunHalf = 1;
+    }
+#else
     HAL_LCD_writeData(ulValue>>8);
     HAL_LCD_writeData(ulValue);
+#endif
 }
 
 
 //*****************************************************************************
 //
-//! Draws a horizontal sequence of pixels on the screen.
-//!
-//! \param pvDisplayData is a pointer to the driver-specific data for this
-//! display driver.
-//! \param lX is the X coordinate of the first pixel.
-//! \param lY is the Y coordinate of the first pixel.
-//! \param lX0 is sub-pixel offset within the pixel data, which is valid for 1
-//! or 4 bit per pixel formats.
-//! \param lCount is the number of pixels to draw.
-//! \param lBPP is the number of bits per pixel; must be 1, 4, or 8.
-//! \param pucData is a pointer to the pixel data.  For 1 and 4 bit per pixel
-//! formats, the most significant bit(s) represent the left-most pixel.
-//! \param pucPalette is a pointer to the palette used to draw the pixels.
-//!
-//! This function draws a horizontal sequence of pixels on the screen, using
-//! the supplied palette.  For 1 bit per pixel format, the palette contains
-//! pre-translated colors; for 4 and 8 bit per pixel formats, the palette
-//! contains 24-bit RGB values that must be translated before being written to
-//! the display.
-//!
-//! \return None.
+// Converts one row of pixel data through the palette into the line buffers.
+// The arguments are those of Crystalfontz128x128_PixelDrawMultiple(); the
+// address window and RAMWR must already have been sent.
 //
 //*****************************************************************************
-static void Crystalfontz128x128_PixelDrawMultiple(void *pvDisplayData, int16_t lX,
-                                           int16_t lY, int16_t lX0, int16_t lCount,
-                                           int16_t lBPP,
-                                           const uint8_t *pucData,
-                                           const uint32_t *pucPalette)
+static void Crystalfontz128x128_QueueRow(int16_t lX0, int16_t lCount,
+                                         int16_t lBPP,
+                                         const uint8_t *pucData,
+                                         const uint32_t *pucPalette)
 {
     uint16_t Data;
 
     //
-    // Set the cursor increment to left to right, followed by top to bottom.
-    //
-    Crystalfontz128x128_SetDrawFrame(lX,lY,lCount,127);
-    HAL_LCD_writeCommand(CM_RAMWR);
-
-    //
+    // Palette lookups are collected in the line buffers and sent one chunk
+    // at a time, by DMA while the following chunk is being converted.
     // Determine how to interpret the pixel data based on the number of bits
     // per pixel.
     //
@@ -246,10 +1149,8 @@ static void Crystalfontz128x128_PixelDrawMultiple(void *pvDisplayData, int16_t l
                 for(; (lX0 < 8) && lCount; lX0++, lCount--)
                 {
                     // Draw this pixel in the appropriate color
-                    HAL_LCD_writeData((((uint32_t *)pucPalette)[(Data >>
-                                                             (7 - lX0)) & 1])>>8);
-                    HAL_LCD_writeData(((uint32_t *)pucPalette)[(Data >>
-                                                             (7 - lX0)) & 1]);
+                    Crystalfontz128x128_QueuePixel(
+                        ((uint32_t *)pucPalette)[(Data >> (7 - lX0)) & 1]);
                 }
 
                 // Start at the beginning of the next byte of image data
@@ -280,9 +1181,8 @@ static void Crystalfontz128x128_PixelDrawMultiple(void *pvDisplayData, int16_t l
                         // and extract the corresponding entry from the palette
                         Data = (*pucData >> 4);
                         Data = (*(uint16_t *)(pucPalette + Data));
-                        // Write to LCD screen
-                        HAL_LCD_writeData(Data>>8);
-                        HAL_LCD_writeData(Data);
+                        // Queue for the LCD screen
+                        Crystalfontz128x128_QueuePixel(Data);
 
                         // Decrement the count of pixels to draw
                         lCount--;
@@ -296,9 +1196,8 @@ static void Crystalfontz128x128_PixelDrawMultiple(void *pvDisplayData, int16_t l
                             // the palette
                             Data = (*pucData++ & 15);
                             Data = (*(uint16_t *)(pucPalette + Data));
-                            // Write to LCD screen
-                            HAL_LCD_writeData(Data>>8);
-                            HAL_LCD_writeData(Data);
+                            // Queue for the LCD screen
+                            Crystalfontz128x128_QueuePixel(Data);
 
                             // Decrement the count of pixels to draw
                             lCount--;
@@ -320,9 +1219,8 @@ static void Crystalfontz128x128_PixelDrawMultiple(void *pvDisplayData, int16_t l
                 // corresponding entry from the palette
                 Data = *pucData++;
                 Data = (*(uint16_t *)(pucPalette + Data));
-                // Write to LCD screen
-                HAL_LCD_writeData(Data>>8);
-                HAL_LCD_writeData(Data);
+                // Queue for the LCD screen
+                Crystalfontz128x128_QueuePixel(Data);
             }
             // The image data has been drawn
             break;
@@ -333,29 +1231,117 @@ static void Crystalfontz128x128_PixelDrawMultiple(void *pvDisplayData, int16_t l
         // write it directly to the display.  This is a special case which is
         // not used by the graphics library but which is helpful to
         // applications which may want to handle, for example, JPEG images.
+        // In 12-bit mode the rows of a blit share their pixel pairs, so the
+        // colors are packed through the line buffers instead.
         //
         case 16:
         {
-            uint16_t usData;
-
-            // Loop while there are more pixels to draw.
+#ifdef LCD_COLOR_12BIT
+            const uint16_t *pusData = (const uint16_t *)pucData;
 
             while(lCount--)
             {
-                // Get the next byte of pixel data and extract the
-                // corresponding entry from the palette
-                usData = *((uint16_t *)pucData);
-                pucData += 2;
-
-                // Translate this palette entry and write it to the screen
-                HAL_LCD_writeData(usData>>8);
-                HAL_LCD_writeData(usData);
+                Crystalfontz128x128_QueuePixel(*pusData++);
             }
+#else
+            Crystalfontz128x128_SendLine();
+            HAL_LCD_writeColorBuffer((const uint16_t *)pucData, lCount);
+#endif
+            break;
         }
     }
 }
 
 
+//*****************************************************************************
+//
+//! Draws a horizontal sequence of pixels on the screen.
+//!
+//! \param pvDisplayData is a pointer to the driver-specific data for this
+//! display driver.
+//! \param lX is the X coordinate of the first pixel.
+//! \param lY is the Y coordinate of the first pixel.
+//! \param lX0 is sub-pixel offset within the pixel data, which is valid for 1
+//! or 4 bit per pixel formats.
+//! \param lCount is the number of pixels to draw.
+//! \param lBPP is the number of bits per pixel; must be 1, 4, or 8.
+//! \param pucData is a pointer to the pixel data.  For 1 and 4 bit per pixel
+//! formats, the most significant bit(s) represent the left-most pixel.
+//! \param pucPalette is a pointer to the palette used to draw the pixels.
+//!
+//! This function draws a horizontal sequence of pixels on the screen, using
+//! the supplied palette.  For 1 bit per pixel format, the palette contains
+//! pre-translated colors; for 4 and 8 bit per pixel formats, the palette
+//! contains 24-bit RGB values that must be translated before being written to
+//! the display.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void Crystalfontz128x128_PixelDrawMultiple(void *pvDisplayData, int16_t lX,
+                                           int16_t lY, int16_t lX0, int16_t lCount,
+                                           int16_t lBPP,
+                                           const uint8_t *pucData,
+                                           const uint32_t *pucPalette)
+{
+    //
+    // Open a window covering exactly this run of pixels.
+    //
+    Crystalfontz128x128_SetDrawFrame(lX, lY, lX + lCount - 1, lY);
+    HAL_LCD_writeCommand(CM_RAMWR);
+
+    Crystalfontz128x128_QueueRow(lX0, lCount, lBPP, pucData, pucPalette);
+
+    //
+    // Send whatever is left of the last chunk.
+    //
+    Crystalfontz128x128_SendLine();
+}
+
+
+//*****************************************************************************
+//
+//! Draws a rectangle of image data on the screen.
+//!
+//! \param pvDisplayData is a pointer to the driver-specific data for this
+//! display driver.
+//! \param lX is the X coordinate of the upper left pixel.
+//! \param lY is the Y coordinate of the upper left pixel.
+//! \param lX0 is sub-pixel offset within the pixel data of each row.
+//! \param lWidth is the number of pixels in each row.
+//! \param lHeight is the number of rows.
+//! \param lBPP is the number of bits per pixel; must be 1, 4, 8 or 16.
+//! \param pucData is a pointer to the pixel data of the first row.
+//! \param lStride is the number of bytes between the starts of two rows.
+//! \param pucPalette is a pointer to the palette used to draw the pixels.
+//!
+//! This function sets one address window for the whole rectangle and sends
+//! every row in a single RAMWR; the panel wraps to the next row by itself.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void Crystalfontz128x128_ImageBlit(void *pvDisplayData, int16_t lX,
+                                          int16_t lY, int16_t lX0,
+                                          int16_t lWidth, int16_t lHeight,
+                                          int16_t lBPP, const uint8_t *pucData,
+                                          int16_t lStride,
+                                          const uint32_t *pucPalette)
+{
+    Crystalfontz128x128_SetDrawFrame(lX, lY, lX + lWidth - 1,
+                                     lY + lHeight - 1);
+    HAL_LCD_writeCommand(CM_RAMWR);
+
+    while (lHeight--)
+    {
+        Crystalfontz128x128_QueueRow(lX0, lWidth, lBPP, pucData, pucPalette);
+        pucData += lStride;
+    }
+
+    Crystalfontz128x128_SendLine();
+}
+
+
 //*****************************************************************************
 //
 //! Draws a horizontal line.
@@ -383,13 +1369,8 @@ static void Crystalfontz128x128_LineDrawH(void *pvDisplayData, int16_t lX1, int1
     //
     // Write the pixel value.
     //
-    int16_t i;
     HAL_LCD_writeCommand(CM_RAMWR);
-    for (i = lX1; i <= lX2; i++)
-    {
-        HAL_LCD_writeData(ulValue>>8);
-        HAL_LCD_writeData(ulValue);
-    }
+    Crystalfontz128x128_WriteRepeat(ulValue, lX2 - lX1 + 1);
 }
 
 
@@ -418,13 +1399,8 @@ static void Crystalfontz128x128_LineDrawV(void *pvDisplayData, int16_t lX, int16
     //
     // Write the pixel value.
     //
-    int16_t i;
     HAL_LCD_writeCommand(CM_RAMWR);
-    for (i = lY1; i <= lY2; i++)
-    {
-        HAL_LCD_writeData(ulValue>>8);
-        HAL_LCD_writeData(ulValue);
-    }
+    Crystalfontz128x128_WriteRepeat(ulValue, lY2 - lY1 + 1);
 }
 
 
@@ -458,14 +1434,9 @@ static void Crystalfontz128x128_RectFill(void *pvDisplayData, const Graphics_Rec
     //
     // Write the pixel value.
     //
-    int16_t i;
-    int16_t pixels = (x1 - x0 + 1) * (y1 - y0 + 1);
+    uint16_t pixels = (x1 - x0 + 1) * (y1 - y0 + 1);
     HAL_LCD_writeCommand(CM_RAMWR);
-    for (i = 0; i <= pixels; i++)
-    {
-        HAL_LCD_writeData(ulValue>>8);
-        HAL_LCD_writeData(ulValue);
-    }
+    Crystalfontz128x128_WriteRepeat(ulValue, pixels);
 }
 
 //*****************************************************************************
@@ -488,12 +1459,21 @@ static void Crystalfontz128x128_RectFill(void *pvDisplayData, const Graphics_Rec
 static uint32_t Crystalfontz128x128_ColorTranslate(void *pvDisplayData,
                                     uint32_t ulValue)
 {
+#ifdef LCD_COLOR_12BIT
+    //
+    // Translate from a 24-bit RGB color to a 4-4-4 RGB color.
+    //
+    return(((((ulValue) & 0x00f00000) >> 12) |
+            (((ulValue) & 0x0000f000) >> 8) |
+            (((ulValue) & 0x000000f0) >> 4)));
+#else
     //
     // Translate from a 24-bit RGB color to a 5-6-5 RGB color.
     //
     return(((((ulValue) & 0x00f80000) >> 8) |
             (((ulValue) & 0x0000fc00) >> 5) |
             (((ulValue) & 0x000000f8) >> 3)));
+#endif
 }
 
 
@@ -506,8 +1486,9 @@ static uint32_t Crystalfontz128x128_ColorTranslate(void *pvDisplayData,
 //!
 //! This functions flushes any cached drawing operations to the display.  This
 //! is useful when a local frame buffer is used for drawing operations, and the
-//! flush would copy the local frame buffer to the display.  For the SSD2119
-//! driver, the flush is a no operation.
+//! flush would copy the local frame buffer to the display.  This driver only
+//! has to finish an open PixelDraw run, and switch the panel on after
+//! Crystalfontz128x128_InitColor().
 //!
 //! \return None.
 //
@@ -516,8 +1497,11 @@ static void
 Crystalfontz128x128_Flush(void *pvDisplayData)
 {
     //
-    // There is nothing to be done.
+    // Nothing is buffered except, in 12-bit mode, the last nibble of an open
+    // PixelDraw run.
     //
+    Crystalfontz128x128_CloseRun();
+    Crystalfontz128x128_DisplayOn();
 }
 
 
@@ -561,8 +1545,8 @@ const Graphics_Display g_sCrystalfontz128x128 =
     Crystalfontz128x128_RectFill,
     Crystalfontz128x128_ColorTranslate,
     Crystalfontz128x128_Flush,
-    Crystalfontz128x128_ClearScreen
-
+    Crystalfontz128x128_ClearScreen,
+    Crystalfontz128x128_ImageBlit
 };
 
 
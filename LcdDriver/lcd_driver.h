@@ -35,7 +35,9 @@
 #define CM_RGBSET          0x2d
 #define CM_RAMRD           0x2E
 #define CM_PTLAR           0x30
+#define CM_SCRLAR          0x33
 #define CM_MADCTL          0x36
+#define CM_VSCSAD          0x37
 #define CM_COLMOD          0x3A
 #define CM_SETPWCTR        0xB1
 #define CM_SETDISPL        0xB2
@@ -54,19 +56,117 @@
 #define CM_MADCTL_BGR      0x08
 #define CM_MADCTL_MH       0x04
 
+// COLMOD interface pixel format, see HAL_LCD_PIXEL_BYTES in lower_driver.h
+#ifdef LCD_COLOR_12BIT
+#define CM_COLMOD_FORMAT   0x03
+#else
+#define CM_COLMOD_FORMAT   0x05
+#endif
+
 extern uint8_t Lcd_Orientation;
 extern uint16_t Lcd_ScreenWidth, Lcd_ScreenHeigth;
 extern uint8_t Lcd_PenSolid, Lcd_FontSolid, Lcd_FlagRead;
 extern uint16_t Lcd_TouchTrim;
 
+//*****************************************************************************
+//
+// Address window statistics, cumulative until cleared.  A pixel is coalesced
+// when it continues the run opened by the previous PixelDraw and needs no
+// address window or RAMWR at all.
+//
+//*****************************************************************************
+typedef struct Lcd_WindowStats
+{
+    uint32_t pixelDraws;        // calls to the PixelDraw callback
+    uint32_t coalesced;         // ...written as the next pixel of an open run
+    uint32_t windows;           // calls to Crystalfontz128x128_SetDrawFrame()
+    uint32_t casetSkipped;      // CASETs left out, columns already set
+    uint32_t rasetSkipped;      // RASETs left out, rows already set
+} Lcd_WindowStats;
+
+//*****************************************************************************
+//
+// Display power states, from full power down.  Frame memory is kept in all
+// of them.
+//
+//*****************************************************************************
+#define LCD_POWER_ACTIVE    0       // whole panel shown, backlight on
+#define LCD_POWER_DIM       1       // backlight faded to the dim level
+#define LCD_POWER_PARTIAL   2       // only the partial area shown (PTLON)
+#define LCD_POWER_OFF       3       // DISPOFF, backlight off
+#define LCD_POWER_SLEEP     4       // SLPIN, oscillator and booster stopped
+#define LCD_POWER_STATES    5
+
+//*****************************************************************************
+//
+// Power statistics, cumulative until cleared.  Times are in microseconds and
+// cover the commands and the waits the controller needs.
+//
+//*****************************************************************************
+typedef struct Lcd_PowerStats
+{
+    uint16_t entries[LCD_POWER_STATES];     // times each state was entered
+    uint32_t enterTime[LCD_POWER_STATES];   // last entry from a lighter state
+    uint32_t exitTime[LCD_POWER_STATES];    // last return to a lighter state
+} Lcd_PowerStats;
+
 extern const Graphics_Display g_sCrystalfontz128x128;
 
+// Crystalfontz128x128_InitColor() argument that leaves frame memory unfilled.
+#define LCD_INIT_NO_FILL        0xFF000000
+
 extern void Crystalfontz128x128_Init(void);
 
+extern void Crystalfontz128x128_InitColor(uint32_t ulColor);
+
+extern void Crystalfontz128x128_InitSplash(const Graphics_Image *pImage,
+                                           uint32_t ulBackground);
+
+extern void Crystalfontz128x128_DisplayOn(void);
+
+extern uint32_t Crystalfontz128x128_GetBootTime(void);
+
 extern void Crystalfontz128x128_SetDrawFrame(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1);
 
 extern void Crystalfontz128x128_SetOrientation(uint8_t orientation);
 
+extern void Crystalfontz128x128_InvalidateWindow(void);
+
+extern void Crystalfontz128x128_SetScrollArea(uint16_t top, uint16_t bottom);
+
+extern void Crystalfontz128x128_SetScrollOffset(uint16_t offset);
+
+extern void Crystalfontz128x128_ScrollOff(void);
+
+extern void Crystalfontz128x128_SetBacklight(uint8_t percent);
+
+extern void Crystalfontz128x128_FadeBacklight(uint8_t percent, uint16_t ms);
+
+extern void Crystalfontz128x128_SetDimBacklight(uint8_t percent);
+
+extern void Crystalfontz128x128_SetPartialArea(uint16_t y0, uint16_t y1);
+
+extern void Crystalfontz128x128_SetIdleTimeout(uint8_t state, uint16_t ms);
+
+extern void Crystalfontz128x128_PowerEnter(uint8_t state);
+
+extern uint8_t Crystalfontz128x128_PowerWake(void);
+
+extern void Crystalfontz128x128_PowerPoll(void);
+
+extern uint8_t Crystalfontz128x128_GetPowerState(void);
+
+extern const Lcd_PowerStats *Crystalfontz128x128_GetPowerStats(void);
+
+extern void Crystalfontz128x128_ClearPowerStats(void);
+
+extern void Crystalfontz128x128_BlitOffscreen(const Graphics_Display *pOffscreen,
+                                              int16_t lX, int16_t lY);
+
+extern const Lcd_WindowStats *Crystalfontz128x128_GetWindowStats(void);
+
+extern void Crystalfontz128x128_ClearWindowStats(void);
+
 #endif /* __CRYSTALFONTZLCD_H__ */
 
 
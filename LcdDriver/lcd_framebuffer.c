@@ -0,0 +1,285 @@
+// lcd_framebuffer.c
+// Framebuffered variant of the Crystalfontz128x128 display driver.
+//
+// The screen is kept in FRAM in the panel's byte order, packed in 12-bit
+// mode, so a changed span can be sent straight from the buffer by DMA.  Each
+// row records the columns drawn since the last flush, and the flush sends
+// those spans.
+
+#include "Grlib/grlib/grlib.h"
+#include "LcdDriver/lcd_driver.h"
+#include "LcdDriver/lcd_framebuffer.h"
+#include "LcdDriver/lcd_rowstore.h"
+#include "LcdDriver/lower_driver.h"
+#include <stdint.h>
+
+#define LCD_ROW_BYTES       HAL_LCD_PIXEL_BYTES(LCD_HORIZONTAL_MAX)
+
+// Row spans shorter than this are cheaper to send from the CPU than to set up
+// a DMA transfer for.
+#define LCD_DMA_MIN_BYTES   32
+
+//*****************************************************************************
+//
+// The screen.  It lives in FRAM; PERSISTENT keeps the startup code from
+// copying 32 KB of initial values into it on every reset (24 KB in 12-bit
+// mode).
+//
+//*****************************************************************************
+#pragma PERSISTENT(Lcd_FrameBuffer)
+static uint8_t Lcd_FrameBuffer[LCD_VERTICAL_MAX][LCD_ROW_BYTES] = { 0 };
+
+//*****************************************************************************
+//
+// Columns drawn in each row since the last flush.  A row is clean when its
+// minimum is above its maximum.
+//
+//*****************************************************************************
+static uint8_t Lcd_DirtyMin[LCD_VERTICAL_MAX];
+static uint8_t Lcd_DirtyMax[LCD_VERTICAL_MAX];
+
+static void Crystalfontz128x128_MarkDirty(int16_t lY, int16_t lX1, int16_t lX2)
+{
+    if (lX1 < Lcd_DirtyMin[lY])
+    {
+        Lcd_DirtyMin[lY] = lX1;
+    }
+    if (lX2 > Lcd_DirtyMax[lY])
+    {
+        Lcd_DirtyMax[lY] = lX2;
+    }
+}
+
+static void Crystalfontz128x128_MarkClean(int16_t lY)
+{
+    Lcd_DirtyMin[lY] = 0xFF;
+    Lcd_DirtyMax[lY] = 0;
+}
+
+static void Crystalfontz128x128_FillSpan(int16_t lY, int16_t lX1, int16_t lX2,
+                                         uint16_t ulValue)
+{
+    uint8_t *row = Lcd_FrameBuffer[lY];
+    int16_t lX;
+
+    for (lX = lX1; lX <= lX2; lX++)
+    {
+        Crystalfontz128x128_StorePixel(row, lX, ulValue);
+    }
+
+    Crystalfontz128x128_MarkDirty(lY, lX1, lX2);
+}
+
+//*****************************************************************************
+//
+//! Prepares the framebuffer for use.
+//!
+//! Every row is marked dirty, so the first flush sends the whole screen: the
+//! panel contents are unknown until then.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void Crystalfontz128x128_BufferInit(void)
+{
+    uint16_t y;
+
+    for (y = 0; y < LCD_VERTICAL_MAX; y++)
+    {
+        Crystalfontz128x128_MarkDirty(y, 0, LCD_HORIZONTAL_MAX - 1);
+    }
+}
+
+static void Crystalfontz128x128_BufferPixelDraw(void *pvDisplayData,
+                                                int16_t lX, int16_t lY,
+                                                uint16_t ulValue)
+{
+    Crystalfontz128x128_StorePixel(Lcd_FrameBuffer[lY], lX, ulValue);
+    Crystalfontz128x128_MarkDirty(lY, lX, lX);
+}
+
+//*****************************************************************************
+//
+// Draws a horizontal sequence of pixels into the framebuffer.  The palette
+// conventions are those of Crystalfontz128x128_PixelDrawMultiple().
+//
+//*****************************************************************************
+static void Crystalfontz128x128_BufferPixelDrawMultiple(void *pvDisplayData,
+                                                        int16_t lX, int16_t lY,
+                                                        int16_t lX0,
+                                                        int16_t lCount,
+                                                        int16_t lBPP,
+                                                        const uint8_t *pucData,
+                                                        const uint32_t *pucPalette)
+{
+    Crystalfontz128x128_MarkDirty(lY, lX, lX + lCount - 1);
+    Crystalfontz128x128_StorePixels(Lcd_FrameBuffer[lY], lX, lX0, lCount, lBPP,
+                                    pucData, pucPalette);
+}
+
+static void Crystalfontz128x128_BufferImageBlit(void *pvDisplayData,
+                                                int16_t lX, int16_t lY,
+                                                int16_t lX0, int16_t lWidth,
+                                                int16_t lHeight, int16_t lBPP,
+                                                const uint8_t *pucData,
+                                                int16_t lStride,
+                                                const uint32_t *pucPalette)
+{
+    while (lHeight--)
+    {
+        Crystalfontz128x128_BufferPixelDrawMultiple(pvDisplayData, lX, lY++,
+                                                    lX0, lWidth, lBPP,
+                                                    pucData, pucPalette);
+        pucData += lStride;
+    }
+}
+
+static void Crystalfontz128x128_BufferLineDrawH(void *pvDisplayData,
+                                                int16_t lX1, int16_t lX2,
+                                                int16_t lY, uint16_t ulValue)
+{
+    Crystalfontz128x128_FillSpan(lY, lX1, lX2, ulValue);
+}
+
+static void Crystalfontz128x128_BufferLineDrawV(void *pvDisplayData,
+                                                int16_t lX, int16_t lY1,
+                                                int16_t lY2, uint16_t ulValue)
+{
+    int16_t lY;
+
+    for (lY = lY1; lY <= lY2; lY++)
+    {
+        Crystalfontz128x128_StorePixel(Lcd_FrameBuffer[lY], lX, ulValue);
+        Crystalfontz128x128_MarkDirty(lY, lX, lX);
+    }
+}
+
+static void Crystalfontz128x128_BufferRectFill(void *pvDisplayData,
+                                               const Graphics_Rectangle *pRect,
+                                               uint16_t ulValue)
+{
+    int16_t lY;
+
+    for (lY = pRect->sYMin; lY <= pRect->sYMax; lY++)
+    {
+        Crystalfontz128x128_FillSpan(lY, pRect->sXMin, pRect->sXMax, ulValue);
+    }
+}
+
+static uint32_t Crystalfontz128x128_BufferColorTranslate(void *pvDisplayData,
+                                                         uint32_t ulValue)
+{
+    return g_sCrystalfontz128x128.callColorTranslate(pvDisplayData, ulValue);
+}
+
+static uint8_t Crystalfontz128x128_RowChanged(uint16_t y)
+{
+    return Lcd_DirtyMin[y] <= Lcd_DirtyMax[y];
+}
+
+//*****************************************************************************
+//
+//! Sends the changed parts of the framebuffer to the panel.
+//!
+//! \param pvDisplayData is a pointer to the driver-specific data for this
+//! display driver.
+//!
+//! Consecutive changed rows are sent as one region: a single address window
+//! spanning the union of their dirty columns, followed by one RAMWR.  In
+//! 12-bit mode the region is widened to whole pixel pairs, so that every row
+//! starts and ends on a byte of the buffer.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void Crystalfontz128x128_BufferFlush(void *pvDisplayData)
+{
+    uint16_t y = 0;
+    uint16_t y0, x0, x1, bytes;
+
+    while (y < LCD_VERTICAL_MAX)
+    {
+        if (!Crystalfontz128x128_RowChanged(y))
+        {
+            y++;
+            continue;
+        }
+
+        y0 = y;
+        x0 = Lcd_DirtyMin[y];
+        x1 = Lcd_DirtyMax[y];
+        while ((++y < LCD_VERTICAL_MAX) && Crystalfontz128x128_RowChanged(y))
+        {
+            if (Lcd_DirtyMin[y] < x0)
+            {
+                x0 = Lcd_DirtyMin[y];
+            }
+            if (Lcd_DirtyMax[y] > x1)
+            {
+                x1 = Lcd_DirtyMax[y];
+            }
+        }
+
+#ifdef LCD_COLOR_12BIT
+        x0 &= ~1;
+        x1 |= 1;
+#endif
+        Crystalfontz128x128_SetDrawFrame(x0, y0, x1, y - 1);
+        HAL_LCD_writeCommand(CM_RAMWR);
+
+        bytes = HAL_LCD_PIXEL_BYTES(x1 - x0 + 1);
+        for (; y0 < y; y0++)
+        {
+            if (bytes >= LCD_DMA_MIN_BYTES)
+            {
+                HAL_LCD_dmaWriteData(&Lcd_FrameBuffer[y0][HAL_LCD_PIXEL_BYTES(x0)],
+                                     bytes, 0);
+            }
+            else
+            {
+                HAL_LCD_writeDataBurst(&Lcd_FrameBuffer[y0][HAL_LCD_PIXEL_BYTES(x0)],
+                                       bytes);
+            }
+            Crystalfontz128x128_MarkClean(y0);
+        }
+    }
+
+    //
+    // The last row may still be on its way out; drawing must not touch the
+    // buffer under the DMA.
+    //
+    HAL_LCD_dmaWait();
+    Crystalfontz128x128_DisplayOn();
+}
+
+static void Crystalfontz128x128_BufferClearScreen(void *pvDisplayData,
+                                                  uint16_t ulValue)
+{
+    Graphics_Rectangle rect = { 0, 0, LCD_HORIZONTAL_MAX - 1,
+                                LCD_VERTICAL_MAX - 1 };
+
+    Crystalfontz128x128_BufferRectFill(pvDisplayData, &rect, ulValue);
+}
+
+//*****************************************************************************
+//
+//! The display structure for the framebuffered driver.  Nothing reaches the
+//! panel until Graphics_flushBuffer() is called.
+//
+//*****************************************************************************
+const Graphics_Display g_sCrystalfontz128x128_Buffered =
+{
+    sizeof(tDisplay),
+    0,
+    LCD_VERTICAL_MAX,
+    LCD_HORIZONTAL_MAX,
+    Crystalfontz128x128_BufferPixelDraw,
+    Crystalfontz128x128_BufferPixelDrawMultiple,
+    Crystalfontz128x128_BufferLineDrawH,
+    Crystalfontz128x128_BufferLineDrawV,
+    Crystalfontz128x128_BufferRectFill,
+    Crystalfontz128x128_BufferColorTranslate,
+    Crystalfontz128x128_BufferFlush,
+    Crystalfontz128x128_BufferClearScreen,
+    Crystalfontz128x128_BufferImageBlit
+};
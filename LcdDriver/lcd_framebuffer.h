@@ -0,0 +1,16 @@
+// lcd_framebuffer.h
+// Framebuffered variant of the Crystalfontz128x128 display driver.  Drawing
+// goes to a copy of the screen in FRAM; Graphics_flushBuffer() sends only the
+// rows that changed since the last flush.
+
+#ifndef LCD_FRAMEBUFFER_H_
+#define LCD_FRAMEBUFFER_H_
+
+#include <stdint.h>
+#include "Grlib/grlib/grlib.h"
+
+extern const Graphics_Display g_sCrystalfontz128x128_Buffered;
+
+extern void Crystalfontz128x128_BufferInit(void);
+
+#endif // LCD_FRAMEBUFFER_H_
@@ -0,0 +1,813 @@
+// lcd_list.c
+// Display lists: a compact byte encoding of a sequence of grlib drawing
+// calls.
+//
+// Recording appends one op per call and never draws.  Replay decodes the ops
+// in order and makes the same grlib calls on a context, so one list can be
+// sent to the panel, a framebuffer, an offscreen image or the banded driver.
+// Strings are copied in, so a list may be built from temporary buffers.
+
+#include "Grlib/grlib/grlib.h"
+#include "LcdDriver/lcd_list.h"
+#include <stdint.h>
+#include <string.h>
+
+// The longest string an op can hold.
+#define LCD_LIST_STRING_MAX     255
+
+//*****************************************************************************
+//
+// Byte encoding helpers.
+//
+//*****************************************************************************
+static uint8_t *Crystalfontz128x128_ListPut16(uint8_t *p, int16_t value)
+{
+    *p++ = value;
+    *p++ = (uint16_t)value >> 8;
+    return p;
+}
+
+static const uint8_t *Crystalfontz128x128_ListGet16(const uint8_t *p,
+                                                    int16_t *value)
+{
+    *value = (int16_t)(p[0] | ((uint16_t)p[1] << 8));
+    return p + 2;
+}
+
+//*****************************************************************************
+//
+// Returns the number of bytes op takes in a list.
+//
+//*****************************************************************************
+static uint16_t Crystalfontz128x128_ListOpBytes(const Lcd_ListOp *op)
+{
+    switch (op->code)
+    {
+        case LCD_LIST_FOREGROUND:
+        case LCD_LIST_BACKGROUND:
+            return 1 + 3;
+        case LCD_LIST_FONT:
+            return 1 + sizeof(const void *);
+        case LCD_LIST_PIXEL:
+            return 1 + 4;
+        case LCD_LIST_LINE:
+        case LCD_LIST_RECT:
+        case LCD_LIST_FILL_RECT:
+            return 1 + 8;
+        case LCD_LIST_CIRCLE:
+        case LCD_LIST_FILL_CIRCLE:
+            return 1 + 6;
+        case LCD_LIST_IMAGE:
+            return 1 + sizeof(const void *) + 4;
+        case LCD_LIST_STRING:
+        case LCD_LIST_STRING_CENTERED:
+            return 1 + 6 + op->length;
+        case LCD_LIST_STRING_WIDTH:
+            return 1 + 8 + op->length;
+        default:
+            return 1;
+    }
+}
+
+//*****************************************************************************
+//
+// Appends op to the list.  The string of a string op may lie in the list
+// itself, at or after the end of what is written, as it does when
+// Crystalfontz128x128_ListOptimize() moves ops down.
+//
+//*****************************************************************************
+static void Crystalfontz128x128_ListPut(Lcd_DisplayList *list,
+                                        const Lcd_ListOp *op)
+{
+    uint16_t bytes = Crystalfontz128x128_ListOpBytes(op);
+    uint8_t *p;
+
+    if (list->length + bytes > list->size)
+    {
+        list->overflow = 1;
+        return;
+    }
+
+    p = list->buffer + list->length;
+    list->length += bytes;
+    *p++ = op->code;
+
+    switch (op->code)
+    {
+        case LCD_LIST_FOREGROUND:
+        case LCD_LIST_BACKGROUND:
+            *p++ = op->color;
+            *p++ = op->color >> 8;
+            *p++ = op->color >> 16;
+            break;
+
+        case LCD_LIST_FONT:
+            memcpy(p, &op->object, sizeof(const void *));
+            break;
+
+        case LCD_LIST_LINE:
+        case LCD_LIST_RECT:
+        case LCD_LIST_FILL_RECT:
+            p = Crystalfontz128x128_ListPut16(p, op->x1);
+            p = Crystalfontz128x128_ListPut16(p, op->y1);
+            p = Crystalfontz128x128_ListPut16(p, op->x2);
+            Crystalfontz128x128_ListPut16(p, op->y2);
+            break;
+
+        case LCD_LIST_CIRCLE:
+        case LCD_LIST_FILL_CIRCLE:
+            p = Crystalfontz128x128_ListPut16(p, op->x1);
+            p = Crystalfontz128x128_ListPut16(p, op->y1);
+            Crystalfontz128x128_ListPut16(p, op->x2);
+            break;
+
+        case LCD_LIST_IMAGE:
+            memcpy(p, &op->object, sizeof(const void *));
+            p += sizeof(const void *);
+            /* fall through */
+        case LCD_LIST_PIXEL:
+            p = Crystalfontz128x128_ListPut16(p, op->x1);
+            Crystalfontz128x128_ListPut16(p, op->y1);
+            break;
+
+        case LCD_LIST_STRING:
+        case LCD_LIST_STRING_CENTERED:
+        case LCD_LIST_STRING_WIDTH:
+            p = Crystalfontz128x128_ListPut16(p, op->x1);
+            p = Crystalfontz128x128_ListPut16(p, op->y1);
+            if (op->code == LCD_LIST_STRING_WIDTH)
+            {
+                p = Crystalfontz128x128_ListPut16(p, op->x2);
+            }
+            *p++ = op->opaque;
+            *p++ = op->length;
+            memmove(p, op->string, op->length);
+            break;
+    }
+}
+
+//*****************************************************************************
+//
+//! Initializes an empty display list.
+//!
+//! \param list is the list to initialize.
+//! \param buffer is the memory the ops are recorded in.
+//! \param size is the size of buffer in bytes.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void Crystalfontz128x128_ListInit(Lcd_DisplayList *list, uint8_t *buffer,
+                                  uint16_t size)
+{
+    list->buffer = buffer;
+    list->size = size;
+    Crystalfontz128x128_ListReset(list);
+}
+
+//*****************************************************************************
+//
+//! Empties a display list, so that another screen can be recorded into it.
+//
+//*****************************************************************************
+void Crystalfontz128x128_ListReset(Lcd_DisplayList *list)
+{
+    list->length = 0;
+    list->overflow = 0;
+}
+
+static void Crystalfontz128x128_ListColor(Lcd_DisplayList *list, uint8_t code,
+                                          uint32_t color)
+{
+    Lcd_ListOp op;
+
+    op.code = code;
+    op.color = color & 0x00FFFFFF;
+    Crystalfontz128x128_ListPut(list, &op);
+}
+
+static void Crystalfontz128x128_ListShape(Lcd_DisplayList *list, uint8_t code,
+                                          int16_t x1, int16_t y1,
+                                          int16_t x2, int16_t y2)
+{
+    Lcd_ListOp op;
+
+    op.code = code;
+    op.x1 = x1;
+    op.y1 = y1;
+    op.x2 = x2;
+    op.y2 = y2;
+    Crystalfontz128x128_ListPut(list, &op);
+}
+
+static void Crystalfontz128x128_ListText(Lcd_DisplayList *list, uint8_t code,
+                                         const int8_t *string, int32_t length,
+                                         int16_t x, int16_t y, bool opaque,
+                                         int16_t width)
+{
+    Lcd_ListOp op;
+
+    if (length == AUTO_STRING_LENGTH)
+    {
+        length = strlen((const char *)string);
+    }
+    if (length > LCD_LIST_STRING_MAX)
+    {
+        length = LCD_LIST_STRING_MAX;
+    }
+
+    op.code = code;
+    op.x1 = x;
+    op.y1 = y;
+    op.x2 = width;
+    op.opaque = opaque;
+    op.length = length;
+    op.string = string;
+    Crystalfontz128x128_ListPut(list, &op);
+}
+
+//*****************************************************************************
+//
+//! Records Graphics_setForegroundColor().
+//
+//*****************************************************************************
+void Crystalfontz128x128_ListSetForeground(Lcd_DisplayList *list,
+                                           uint32_t color)
+{
+    Crystalfontz128x128_ListColor(list, LCD_LIST_FOREGROUND, color);
+}
+
+//*****************************************************************************
+//
+//! Records Graphics_setBackgroundColor().
+//
+//*****************************************************************************
+void Crystalfontz128x128_ListSetBackground(Lcd_DisplayList *list,
+                                           uint32_t color)
+{
+    Crystalfontz128x128_ListColor(list, LCD_LIST_BACKGROUND, color);
+}
+
+//*****************************************************************************
+//
+//! Records Graphics_setFont().
+//
+//*****************************************************************************
+void Crystalfontz128x128_ListSetFont(Lcd_DisplayList *list,
+                                     const Graphics_Font *font)
+{
+    Lcd_ListOp op;
+
+    op.code = LCD_LIST_FONT;
+    op.object = font;
+    Crystalfontz128x128_ListPut(list, &op);
+}
+
+//*****************************************************************************
+//
+//! Records Graphics_clearDisplay().
+//
+//*****************************************************************************
+void Crystalfontz128x128_ListClear(Lcd_DisplayList *list)
+{
+    Crystalfontz128x128_ListShape(list, LCD_LIST_CLEAR, 0, 0, 0, 0);
+}
+
+//*****************************************************************************
+//
+//! Records Graphics_drawPixel().
+//
+//*****************************************************************************
+void Crystalfontz128x128_ListDrawPixel(Lcd_DisplayList *list, int16_t x,
+                                       int16_t y)
+{
+    Crystalfontz128x128_ListShape(list, LCD_LIST_PIXEL, x, y, 0, 0);
+}
+
+//*****************************************************************************
+//
+//! Records Graphics_drawLine().
+//
+//*****************************************************************************
+void Crystalfontz128x128_ListDrawLine(Lcd_DisplayList *list, int16_t x1,
+                                      int16_t y1, int16_t x2, int16_t y2)
+{
+    Crystalfontz128x128_ListShape(list, LCD_LIST_LINE, x1, y1, x2, y2);
+}
+
+//*****************************************************************************
+//
+//! Records Graphics_drawRectangle().
+//
+//*****************************************************************************
+void Crystalfontz128x128_ListDrawRectangle(Lcd_DisplayList *list,
+                                           const Graphics_Rectangle *rect)
+{
+    Crystalfontz128x128_ListShape(list, LCD_LIST_RECT, rect->xMin, rect->yMin,
+                                  rect->xMax, rect->yMax);
+}
+
+//*****************************************************************************
+//
+//! Records Graphics_fillRectangle().
+//
+//*****************************************************************************
+void Crystalfontz128x128_ListFillRectangle(Lcd_DisplayList *list,
+                                           const Graphics_Rectangle *rect)
+{
+    Crystalfontz128x128_ListShape(list, LCD_LIST_FILL_RECT, rect->xMin,
+                                  rect->yMin, rect->xMax, rect->yMax);
+}
+
+//*****************************************************************************
+//
+//! Records Graphics_drawCircle().
+//
+//*****************************************************************************
+void Crystalfontz128x128_ListDrawCircle(Lcd_DisplayList *list, int16_t x,
+                                        int16_t y, int16_t radius)
+{
+    Crystalfontz128x128_ListShape(list, LCD_LIST_CIRCLE, x, y, radius, 0);
+}
+
+//*****************************************************************************
+//
+//! Records Graphics_fillCircle().
+//
+//*****************************************************************************
+void Crystalfontz128x128_ListFillCircle(Lcd_DisplayList *list, int16_t x,
+                                        int16_t y, int16_t radius)
+{
+    Crystalfontz128x128_ListShape(list, LCD_LIST_FILL_CIRCLE, x, y, radius, 0);
+}
+
+//*****************************************************************************
+//
+//! Records Graphics_drawImage().  The image is not copied and must outlive
+//! the list.
+//
+//*****************************************************************************
+void Crystalfontz128x128_ListDrawImage(Lcd_DisplayList *list,
+                                       const Graphics_Image *image,
+                                       int16_t x, int16_t y)
+{
+    Lcd_ListOp op;
+
+    op.code = LCD_LIST_IMAGE;
+    op.object = image;
+    op.x1 = x;
+    op.y1 = y;
+    Crystalfontz128x128_ListPut(list, &op);
+}
+
+//*****************************************************************************
+//
+//! Records Graphics_drawString().  Up to 255 characters are copied into the
+//! list.
+//
+//*****************************************************************************
+void Crystalfontz128x128_ListDrawString(Lcd_DisplayList *list,
+                                        const int8_t *string, int32_t length,
+                                        int16_t x, int16_t y, bool opaque)
+{
+    Crystalfontz128x128_ListText(list, LCD_LIST_STRING, string, length, x, y,
+                                 opaque, 0);
+}
+
+//*****************************************************************************
+//
+//! Records Graphics_drawStringCentered().  Up to 255 characters are copied
+//! into the list.
+//
+//*****************************************************************************
+void Crystalfontz128x128_ListDrawStringCentered(Lcd_DisplayList *list,
+                                                const int8_t *string,
+                                                int32_t length,
+                                                int16_t x, int16_t y,
+                                                bool opaque)
+{
+    Crystalfontz128x128_ListText(list, LCD_LIST_STRING_CENTERED, string,
+                                 length, x, y, opaque, 0);
+}
+
+//*****************************************************************************
+//
+//! Records Graphics_drawStringCenteredWidth().  Up to 255 characters are
+//! copied into the list.  The width is kept with them, so neither replay nor
+//! Crystalfontz128x128_ScreenShow() measures the string.
+//
+//*****************************************************************************
+void Crystalfontz128x128_ListDrawStringCenteredWidth(Lcd_DisplayList *list,
+                                                     const int8_t *string,
+                                                     int32_t length,
+                                                     int16_t x, int16_t y,
+                                                     bool opaque,
+                                                     int16_t width)
+{
+    Crystalfontz128x128_ListText(list, LCD_LIST_STRING_WIDTH, string,
+                                 length, x, y, opaque, width);
+}
+
+//*****************************************************************************
+//
+//! Records Graphics_flushBuffer().
+//
+//*****************************************************************************
+void Crystalfontz128x128_ListFlush(Lcd_DisplayList *list)
+{
+    Crystalfontz128x128_ListShape(list, LCD_LIST_FLUSH, 0, 0, 0, 0);
+}
+
+//*****************************************************************************
+//
+//! Decodes one op of a display list.
+//!
+//! \param list is the list to read.
+//! \param offset is the offset of the op, 0 for the first.
+//! \param op is where the op is decoded to.
+//!
+//! A list is walked with
+//! for (offset = 0; offset < list->length; )
+//!     offset = Crystalfontz128x128_ListNext(list, offset, &op);
+//!
+//! \return Returns the offset of the following op.
+//
+//*****************************************************************************
+uint16_t Crystalfontz128x128_ListNext(const Lcd_DisplayList *list,
+                                      uint16_t offset, Lcd_ListOp *op)
+{
+    const uint8_t *p = list->buffer + offset;
+
+    op->code = *p++;
+
+    switch (op->code)
+    {
+        case LCD_LIST_FOREGROUND:
+        case LCD_LIST_BACKGROUND:
+            op->color = p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16);
+            break;
+
+        case LCD_LIST_FONT:
+            memcpy(&op->object, p, sizeof(const void *));
+            break;
+
+        case LCD_LIST_LINE:
+        case LCD_LIST_RECT:
+        case LCD_LIST_FILL_RECT:
+            p = Crystalfontz128x128_ListGet16(p, &op->x1);
+            p = Crystalfontz128x128_ListGet16(p, &op->y1);
+            p = Crystalfontz128x128_ListGet16(p, &op->x2);
+            Crystalfontz128x128_ListGet16(p, &op->y2);
+            break;
+
+        case LCD_LIST_CIRCLE:
+        case LCD_LIST_FILL_CIRCLE:
+            p = Crystalfontz128x128_ListGet16(p, &op->x1);
+            p = Crystalfontz128x128_ListGet16(p, &op->y1);
+            Crystalfontz128x128_ListGet16(p, &op->x2);
+            break;
+
+        case LCD_LIST_IMAGE:
+            memcpy(&op->object, p, sizeof(const void *));
+            p += sizeof(const void *);
+            /* fall through */
+        case LCD_LIST_PIXEL:
+            p = Crystalfontz128x128_ListGet16(p, &op->x1);
+            Crystalfontz128x128_ListGet16(p, &op->y1);
+            break;
+
+        case LCD_LIST_STRING:
+        case LCD_LIST_STRING_CENTERED:
+        case LCD_LIST_STRING_WIDTH:
+            p = Crystalfontz128x128_ListGet16(p, &op->x1);
+            p = Crystalfontz128x128_ListGet16(p, &op->y1);
+            if (op->code == LCD_LIST_STRING_WIDTH)
+            {
+                p = Crystalfontz128x128_ListGet16(p, &op->x2);
+            }
+            op->opaque = *p++;
+            op->length = *p++;
+            op->string = (const int8_t *)p;
+            break;
+    }
+
+    return offset + Crystalfontz128x128_ListOpBytes(op);
+}
+
+//*****************************************************************************
+//
+//! Makes the grlib call an op records.
+//!
+//! \param context is the context to draw on.
+//! \param op is the op, as decoded by Crystalfontz128x128_ListNext().
+//!
+//! \return None.
+//
+//*****************************************************************************
+void Crystalfontz128x128_ListDraw(Graphics_Context *context,
+                                  const Lcd_ListOp *op)
+{
+    Graphics_Rectangle rect;
+
+    switch (op->code)
+    {
+        case LCD_LIST_FOREGROUND:
+            Graphics_setForegroundColor(context, op->color);
+            break;
+
+        case LCD_LIST_BACKGROUND:
+            Graphics_setBackgroundColor(context, op->color);
+            break;
+
+        case LCD_LIST_FONT:
+            Graphics_setFont(context, op->object);
+            break;
+
+        case LCD_LIST_CLEAR:
+            Graphics_clearDisplay(context);
+            break;
+
+        case LCD_LIST_PIXEL:
+            Graphics_drawPixel(context, op->x1, op->y1);
+            break;
+
+        case LCD_LIST_LINE:
+            Graphics_drawLine(context, op->x1, op->y1, op->x2, op->y2);
+            break;
+
+        case LCD_LIST_RECT:
+        case LCD_LIST_FILL_RECT:
+            rect.xMin = op->x1;
+            rect.yMin = op->y1;
+            rect.xMax = op->x2;
+            rect.yMax = op->y2;
+            if (op->code == LCD_LIST_RECT)
+            {
+                Graphics_drawRectangle(context, &rect);
+            }
+            else
+            {
+                Graphics_fillRectangle(context, &rect);
+            }
+            break;
+
+        case LCD_LIST_CIRCLE:
+            Graphics_drawCircle(context, op->x1, op->y1, op->x2);
+            break;
+
+        case LCD_LIST_FILL_CIRCLE:
+            Graphics_fillCircle(context, op->x1, op->y1, op->x2);
+            break;
+
+        case LCD_LIST_IMAGE:
+            Graphics_drawImage(context, op->object, op->x1, op->y1);
+            break;
+
+        case LCD_LIST_STRING:
+            Graphics_drawString(context, (int8_t *)op->string, op->length,
+                                op->x1, op->y1, op->opaque);
+            break;
+
+        case LCD_LIST_STRING_CENTERED:
+            Graphics_drawStringCentered(context, (int8_t *)op->string,
+                                        op->length, op->x1, op->y1,
+                                        op->opaque);
+            break;
+
+        case LCD_LIST_STRING_WIDTH:
+            Graphics_drawStringCenteredWidth(context, (int8_t *)op->string,
+                                             op->length, op->x1, op->y1,
+                                             op->opaque, op->x2);
+            break;
+
+        case LCD_LIST_FLUSH:
+            Graphics_flushBuffer(context);
+            break;
+    }
+}
+
+//*****************************************************************************
+//
+//! Replays a display list.
+//!
+//! \param list is the list to replay.
+//! \param context is the context to draw on; it is left with the colors and
+//! font the list last set.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void Crystalfontz128x128_ListReplay(const Lcd_DisplayList *list,
+                                    Graphics_Context *context)
+{
+    Lcd_ListOp op;
+    uint16_t offset;
+
+    for (offset = 0; offset < list->length; )
+    {
+        offset = Crystalfontz128x128_ListNext(list, offset, &op);
+        Crystalfontz128x128_ListDraw(context, &op);
+    }
+}
+
+//*****************************************************************************
+//
+// State of the optimizer: the colors and font the replay context will have
+// once the ops written so far have run (valid only once set), and those the
+// ops read so far ask for.
+//
+//*****************************************************************************
+typedef struct Lcd_ListState
+{
+    uint8_t valid;          // bit per LCD_LIST_FOREGROUND..LCD_LIST_FONT
+    uint32_t foreground;
+    uint32_t background;
+    const void *font;
+} Lcd_ListState;
+
+#define LCD_LIST_STATE_BIT(code)    (1 << (code))
+
+static uint8_t Crystalfontz128x128_ListSameState(const Lcd_ListState *a,
+                                                 const Lcd_ListState *b,
+                                                 uint8_t code)
+{
+    if (!(a->valid & b->valid & LCD_LIST_STATE_BIT(code)))
+    {
+        return !((a->valid | b->valid) & LCD_LIST_STATE_BIT(code));
+    }
+
+    switch (code)
+    {
+        case LCD_LIST_FOREGROUND:
+            return a->foreground == b->foreground;
+        case LCD_LIST_BACKGROUND:
+            return a->background == b->background;
+        default:
+            return a->font == b->font;
+    }
+}
+
+//*****************************************************************************
+//
+// Writes the state changes still owed before the next drawing op.
+//
+//*****************************************************************************
+static void Crystalfontz128x128_ListPutState(Lcd_DisplayList *list,
+                                             Lcd_ListState *written,
+                                             const Lcd_ListState *wanted)
+{
+    Lcd_ListOp op;
+    uint8_t code;
+
+    for (code = LCD_LIST_FOREGROUND; code <= LCD_LIST_FONT; code++)
+    {
+        if (Crystalfontz128x128_ListSameState(written, wanted, code))
+        {
+            continue;
+        }
+
+        op.code = code;
+        op.color = (code == LCD_LIST_FOREGROUND) ? wanted->foreground :
+                                                   wanted->background;
+        op.object = wanted->font;
+        Crystalfontz128x128_ListPut(list, &op);
+    }
+    *written = *wanted;
+}
+
+//*****************************************************************************
+//
+// Returns nonzero if filled rectangle b continues a along one side, so that
+// the two are one rectangle.
+//
+//*****************************************************************************
+static uint8_t Crystalfontz128x128_ListJoins(const Lcd_ListOp *a,
+                                             const Lcd_ListOp *b)
+{
+    if ((a->x1 == b->x1) && (a->x2 == b->x2))
+    {
+        return (b->y1 <= a->y2 + 1) && (b->y2 >= a->y1 - 1);
+    }
+    if ((a->y1 == b->y1) && (a->y2 == b->y2))
+    {
+        return (b->x1 <= a->x2 + 1) && (b->x2 >= a->x1 - 1);
+    }
+    return 0;
+}
+
+//*****************************************************************************
+//
+//! Shrinks a display list without changing what it draws.
+//!
+//! \param list is the list to optimize, in place.
+//!
+//! Color and font changes are dropped when they set what is already set or
+//! are overridden before anything is drawn with them.  Ops drawn since the
+//! last flush are dropped when a clear follows, since nothing shows them.
+//! Filled rectangles of one color that together make up a rectangle, such
+//! as consecutive row spans of the same width, are merged into one fill and
+//! so into one address window.  Ops are not otherwise reordered, so overlaps
+//! come out as recorded.
+//!
+//! \return Returns the number of bytes saved.
+//
+//*****************************************************************************
+uint16_t Crystalfontz128x128_ListOptimize(Lcd_DisplayList *list)
+{
+    Lcd_ListState written = { 0 };
+    Lcd_ListState wanted = { 0 };
+    Lcd_ListState flushedState = { 0 };
+    Lcd_ListOp op, fill;
+    uint16_t offset, end, flushed;
+    uint8_t pending = 0;
+
+    flushed = 0;
+    end = list->length;
+    list->length = 0;
+
+    for (offset = 0; offset < end; )
+    {
+        offset = Crystalfontz128x128_ListNext(list, offset, &op);
+
+        switch (op.code)
+        {
+            case LCD_LIST_FOREGROUND:
+                wanted.foreground = op.color;
+                wanted.valid |= LCD_LIST_STATE_BIT(op.code);
+                continue;
+
+            case LCD_LIST_BACKGROUND:
+                wanted.background = op.color;
+                wanted.valid |= LCD_LIST_STATE_BIT(op.code);
+                continue;
+
+            case LCD_LIST_FONT:
+                wanted.font = op.object;
+                wanted.valid |= LCD_LIST_STATE_BIT(op.code);
+                continue;
+
+            case LCD_LIST_CLEAR:
+                //
+                // Everything since the last flush is about to be covered.
+                //
+                list->length = flushed;
+                written = flushedState;
+                pending = 0;
+                break;
+
+            case LCD_LIST_FILL_RECT:
+                if (pending &&
+                    Crystalfontz128x128_ListSameState(&written, &wanted,
+                                                      LCD_LIST_FOREGROUND) &&
+                    Crystalfontz128x128_ListJoins(&fill, &op))
+                {
+                    fill.x1 = (op.x1 < fill.x1) ? op.x1 : fill.x1;
+                    fill.y1 = (op.y1 < fill.y1) ? op.y1 : fill.y1;
+                    fill.x2 = (op.x2 > fill.x2) ? op.x2 : fill.x2;
+                    fill.y2 = (op.y2 > fill.y2) ? op.y2 : fill.y2;
+                    continue;
+                }
+                break;
+        }
+
+        if (pending)
+        {
+            Crystalfontz128x128_ListPut(list, &fill);
+            pending = 0;
+        }
+
+        if (op.code != LCD_LIST_FLUSH)
+        {
+            Crystalfontz128x128_ListPutState(list, &written, &wanted);
+        }
+
+        //
+        // A fill is held back in case the next op extends it.  Its color has
+        // already been written.
+        //
+        if (op.code == LCD_LIST_FILL_RECT)
+        {
+            fill = op;
+            pending = 1;
+            continue;
+        }
+
+        Crystalfontz128x128_ListPut(list, &op);
+
+        if (op.code == LCD_LIST_FLUSH)
+        {
+            flushed = list->length;
+            flushedState = written;
+        }
+    }
+
+    if (pending)
+    {
+        Crystalfontz128x128_ListPut(list, &fill);
+    }
+
+    // Leave the context as the unoptimized list would.
+    Crystalfontz128x128_ListPutState(list, &written, &wanted);
+
+    return end - list->length;
+}
@@ -0,0 +1,134 @@
+// lcd_list.h
+// Display lists: a compact byte encoding of a sequence of grlib drawing
+// calls.  A screen recorded once can be replayed to any Graphics_Display,
+// optimized beforehand, or walked op by op to analyze or compare it.
+
+#ifndef LCD_LIST_H_
+#define LCD_LIST_H_
+
+#include <stdint.h>
+#include "Grlib/grlib/grlib.h"
+
+//*****************************************************************************
+//
+// Op codes.  Each op is its code byte followed by its arguments; coordinates
+// are 16-bit little-endian, colors 24-bit RGB in three bytes, and fonts and
+// images native pointers.  Strings are copied into the list.
+//
+//*****************************************************************************
+#define LCD_LIST_FOREGROUND         1   // color
+#define LCD_LIST_BACKGROUND         2   // color
+#define LCD_LIST_FONT               3   // font
+#define LCD_LIST_CLEAR              4
+#define LCD_LIST_PIXEL              5   // x, y
+#define LCD_LIST_LINE               6   // x1, y1, x2, y2
+#define LCD_LIST_RECT               7   // xMin, yMin, xMax, yMax
+#define LCD_LIST_FILL_RECT          8   // xMin, yMin, xMax, yMax
+#define LCD_LIST_CIRCLE             9   // x, y, radius
+#define LCD_LIST_FILL_CIRCLE        10  // x, y, radius
+#define LCD_LIST_IMAGE              11  // image, x, y
+#define LCD_LIST_STRING             12  // x, y, opaque, length, characters
+#define LCD_LIST_STRING_CENTERED    13  // x, y, opaque, length, characters
+#define LCD_LIST_FLUSH              14
+#define LCD_LIST_STRING_WIDTH       15  // x, y, width, opaque, length,
+                                        // characters; drawn centered
+
+typedef struct Lcd_DisplayList
+{
+    uint8_t *buffer;
+    uint16_t size;          // bytes available in buffer
+    uint16_t length;        // bytes recorded
+    uint8_t overflow;       // set if an op did not fit and was dropped
+} Lcd_DisplayList;
+
+//*****************************************************************************
+//
+// One op, decoded.  The coordinates are those of the call; a circle's radius
+// and a string's width are in x2.  string points into the list.
+//
+//*****************************************************************************
+typedef struct Lcd_ListOp
+{
+    uint8_t code;
+    uint8_t opaque;
+    uint8_t length;
+    int16_t x1, y1, x2, y2;
+    uint32_t color;
+    const void *object;     // the font or image
+    const int8_t *string;
+} Lcd_ListOp;
+
+extern void Crystalfontz128x128_ListInit(Lcd_DisplayList *list,
+                                         uint8_t *buffer, uint16_t size);
+
+extern void Crystalfontz128x128_ListReset(Lcd_DisplayList *list);
+
+extern void Crystalfontz128x128_ListSetForeground(Lcd_DisplayList *list,
+                                                  uint32_t color);
+
+extern void Crystalfontz128x128_ListSetBackground(Lcd_DisplayList *list,
+                                                  uint32_t color);
+
+extern void Crystalfontz128x128_ListSetFont(Lcd_DisplayList *list,
+                                            const Graphics_Font *font);
+
+extern void Crystalfontz128x128_ListClear(Lcd_DisplayList *list);
+
+extern void Crystalfontz128x128_ListDrawPixel(Lcd_DisplayList *list,
+                                              int16_t x, int16_t y);
+
+extern void Crystalfontz128x128_ListDrawLine(Lcd_DisplayList *list,
+                                             int16_t x1, int16_t y1,
+                                             int16_t x2, int16_t y2);
+
+extern void Crystalfontz128x128_ListDrawRectangle(Lcd_DisplayList *list,
+                                                  const Graphics_Rectangle *rect);
+
+extern void Crystalfontz128x128_ListFillRectangle(Lcd_DisplayList *list,
+                                                  const Graphics_Rectangle *rect);
+
+extern void Crystalfontz128x128_ListDrawCircle(Lcd_DisplayList *list,
+                                               int16_t x, int16_t y,
+                                               int16_t radius);
+
+extern void Crystalfontz128x128_ListFillCircle(Lcd_DisplayList *list,
+                                               int16_t x, int16_t y,
+                                               int16_t radius);
+
+extern void Crystalfontz128x128_ListDrawImage(Lcd_DisplayList *list,
+                                              const Graphics_Image *image,
+                                              int16_t x, int16_t y);
+
+extern void Crystalfontz128x128_ListDrawString(Lcd_DisplayList *list,
+                                               const int8_t *string,
+                                               int32_t length,
+                                               int16_t x, int16_t y,
+                                               bool opaque);
+
+extern void Crystalfontz128x128_ListDrawStringCentered(Lcd_DisplayList *list,
+                                                       const int8_t *string,
+                                                       int32_t length,
+                                                       int16_t x, int16_t y,
+                                                       bool opaque);
+
+extern void Crystalfontz128x128_ListDrawStringCenteredWidth(Lcd_DisplayList *list,
+                                                            const int8_t *string,
+                                                            int32_t length,
+                                                            int16_t x, int16_t y,
+                                                            bool opaque,
+                                                            int16_t width);
+
+extern void Crystalfontz128x128_ListFlush(Lcd_DisplayList *list);
+
+extern uint16_t Crystalfontz128x128_ListNext(const Lcd_DisplayList *list,
+                                             uint16_t offset, Lcd_ListOp *op);
+
+extern void Crystalfontz128x128_ListDraw(Graphics_Context *context,
+                                         const Lcd_ListOp *op);
+
+extern void Crystalfontz128x128_ListReplay(const Lcd_DisplayList *list,
+                                           Graphics_Context *context);
+
+extern uint16_t Crystalfontz128x128_ListOptimize(Lcd_DisplayList *list);
+
+#endif // LCD_LIST_H_
@@ -0,0 +1,116 @@
+// lcd_rowstore.h
+// Drawing into a row held in the panel's byte order, shared by the drivers
+// that render into memory (lcd_framebuffer.c and lcd_band.c).  A row is
+// HAL_LCD_PIXEL_BYTES(LCD_HORIZONTAL_MAX) bytes, packed in 12-bit mode.
+
+#ifndef LCD_ROWSTORE_H_
+#define LCD_ROWSTORE_H_
+
+#include <stdint.h>
+
+//*****************************************************************************
+//
+// Stores one pixel of a row.  In 12-bit mode the pixels of a pair share the
+// middle byte, so only the nibble of this pixel is replaced.
+//
+//*****************************************************************************
+static inline void Crystalfontz128x128_StorePixel(uint8_t *row, int16_t lX,
+                                                  uint16_t ulValue)
+{
+#ifdef LCD_COLOR_12BIT
+    uint8_t *pixel = &row[(lX >> 1) * 3];
+
+    if (lX & 1)
+    {
+        pixel[1] = (pixel[1] & 0xF0) | ((ulValue >> 8) & 0x0F);
+        pixel[2] = ulValue;
+    }
+    else
+    {
+        pixel[0] = ulValue >> 4;
+        pixel[1] = (pixel[1] & 0x0F) | (ulValue << 4);
+    }
+#else
+    uint8_t *pixel = &row[lX * 2];
+
+    pixel[0] = ulValue >> 8;
+    pixel[1] = ulValue;
+#endif
+}
+
+//*****************************************************************************
+//
+// Stores a horizontal sequence of pixels into a row, starting at column lX.
+// The palette conventions are those of Crystalfontz128x128_PixelDrawMultiple():
+// at 1, 4 and 8 bpp each pixel is an index into pucPalette, whose entries
+// are already translated to the panel's colors; at 16 bpp the data is in the
+// panel's format.
+//
+//*****************************************************************************
+static inline void Crystalfontz128x128_StorePixels(uint8_t *row, int16_t lX,
+                                                   int16_t lX0, int16_t lCount,
+                                                   int16_t lBPP,
+                                                   const uint8_t *pucData,
+                                                   const uint32_t *pucPalette)
+{
+    uint16_t Data;
+
+    switch(lBPP)
+    {
+        case 1:
+        {
+            while(lCount > 0)
+            {
+                Data = *pucData++;
+                for(; (lX0 < 8) && lCount; lX0++, lCount--)
+                {
+                    Crystalfontz128x128_StorePixel(row, lX++,
+                        pucPalette[(Data >> (7 - lX0)) & 1]);
+                }
+                lX0 = 0;
+            }
+            break;
+        }
+
+        case 4:
+        {
+            while(lCount--)
+            {
+                if(lX0 & 1)
+                {
+                    Data = *pucData++ & 15;
+                }
+                else
+                {
+                    Data = *pucData >> 4;
+                }
+                lX0++;
+                Crystalfontz128x128_StorePixel(row, lX++, pucPalette[Data]);
+            }
+            break;
+        }
+
+        case 8:
+        {
+            while(lCount--)
+            {
+                Data = *pucData++;
+                Crystalfontz128x128_StorePixel(row, lX++, pucPalette[Data]);
+            }
+            break;
+        }
+
+        case 16:
+        {
+            const uint16_t *pusData = (const uint16_t *)pucData;
+
+            while(lCount--)
+            {
+                Crystalfontz128x128_StorePixel(row, lX++, *pusData++);
+            }
+            break;
+        }
+    }
+}
+
+#endif // LCD_ROWSTORE_H_
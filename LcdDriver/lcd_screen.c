@@ -0,0 +1,662 @@
+// lcd_screen.c
+// Retained screens built on display lists.
+//
+// A screen is recorded into a display list that starts with a clear, then
+// shown.  The list on the panel is kept, and the drawing ops of the next
+// list are matched against it in order; ops with the same arguments, colors
+// and font are left alone.  The boxes of the ops that no longer match are
+// erased to the background, and every op of the new list that falls in a
+// box is replayed clipped to it, so overlaps come out as a full redraw
+// would.  Boxes where ops were only added are drawn over without erasing,
+// as are those of removed ops that an added opaque string paints over
+// whole, so text updated in place is rewritten in one window.
+
+#include "Grlib/grlib/grlib.h"
+#include "LcdDriver/lcd_list.h"
+#include "LcdDriver/lcd_screen.h"
+#include <stdint.h>
+#include <string.h>
+
+static Lcd_ScreenStats Lcd_ScreenCounters;
+
+// The damage of one Crystalfontz128x128_ScreenShow().
+static Graphics_Rectangle Lcd_ScreenBox[LCD_SCREEN_BOXES];
+static uint8_t Lcd_ScreenErase[LCD_SCREEN_BOXES];
+static uint8_t Lcd_ScreenBoxes;
+
+//*****************************************************************************
+//
+//! Initializes a retained screen.
+//!
+//! \param screen is the screen to initialize.
+//! \param buffer0 and \param buffer1 hold the shown and the next list.
+//! \param size is the size of each buffer in bytes.
+//!
+//! Nothing is known to be on the panel, so the first screen shown is drawn
+//! in full.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void Crystalfontz128x128_ScreenInit(Lcd_Screen *screen, uint8_t *buffer0,
+                                    uint8_t *buffer1, uint16_t size)
+{
+    Crystalfontz128x128_ListInit(&screen->lists[0], buffer0, size);
+    Crystalfontz128x128_ListInit(&screen->lists[1], buffer1, size);
+    screen->shown = 0;
+    screen->valid = 0;
+    screen->begun = 1;
+}
+
+//*****************************************************************************
+//
+//! Returns the list of the next screen, to record into.  After
+//! Crystalfontz128x128_ScreenShow() it holds a copy of the screen shown, so
+//! ops recorded then are added to it.
+//
+//*****************************************************************************
+Lcd_DisplayList *Crystalfontz128x128_ScreenList(Lcd_Screen *screen)
+{
+    return &screen->lists[screen->shown ^ 1];
+}
+
+//*****************************************************************************
+//
+//! Starts recording a new screen from nothing.  The first op recorded should
+//! be a clear.
+//
+//*****************************************************************************
+void Crystalfontz128x128_ScreenBegin(Lcd_Screen *screen)
+{
+    Crystalfontz128x128_ListReset(Crystalfontz128x128_ScreenList(screen));
+    screen->begun = 1;
+}
+
+//*****************************************************************************
+//
+//! Forgets what is on the panel, after something has drawn on it behind the
+//! screen's back.  The next screen shown is drawn in full.
+//
+//*****************************************************************************
+void Crystalfontz128x128_ScreenInvalidate(Lcd_Screen *screen)
+{
+    screen->valid = 0;
+}
+
+const Lcd_ScreenStats *Crystalfontz128x128_GetScreenStats(void)
+{
+    return &Lcd_ScreenCounters;
+}
+
+void Crystalfontz128x128_ClearScreenStats(void)
+{
+    memset(&Lcd_ScreenCounters, 0, sizeof(Lcd_ScreenCounters));
+}
+
+//*****************************************************************************
+//
+// Op classes.  Drawing ops are diffed; state ops are applied to a context as
+// a list is walked; clears and flushes are handled by the walk itself.
+//
+//*****************************************************************************
+static uint8_t Crystalfontz128x128_ScreenDrawing(uint8_t code)
+{
+    return ((code >= LCD_LIST_PIXEL) && (code <= LCD_LIST_STRING_CENTERED)) ||
+           (code == LCD_LIST_STRING_WIDTH);
+}
+
+static void Crystalfontz128x128_ScreenState(Graphics_Context *context,
+                                            const Lcd_ListOp *op)
+{
+    if (op->code <= LCD_LIST_FONT)
+    {
+        Crystalfontz128x128_ListDraw(context, op);
+    }
+}
+
+static void Crystalfontz128x128_ScreenStart(Graphics_Context *context,
+                                            uint32_t foreground,
+                                            uint32_t background,
+                                            const Graphics_Font *font)
+{
+    context->foreground = foreground;
+    context->background = background;
+    context->font = font;
+}
+
+//*****************************************************************************
+//
+// Returns the box an op draws in, given the colors and font it is drawn
+// with.
+//
+//*****************************************************************************
+static void Crystalfontz128x128_ScreenOpBox(const Graphics_Context *context,
+                                            const Lcd_ListOp *op,
+                                            Graphics_Rectangle *box)
+{
+    const Graphics_Image *image;
+    int16_t width;
+
+    box->xMin = op->x1;
+    box->yMin = op->y1;
+    box->xMax = op->x1;
+    box->yMax = op->y1;
+
+    switch (op->code)
+    {
+        case LCD_LIST_LINE:
+        case LCD_LIST_RECT:
+        case LCD_LIST_FILL_RECT:
+            box->xMin = (op->x1 < op->x2) ? op->x1 : op->x2;
+            box->yMin = (op->y1 < op->y2) ? op->y1 : op->y2;
+            box->xMax = (op->x1 > op->x2) ? op->x1 : op->x2;
+            box->yMax = (op->y1 > op->y2) ? op->y1 : op->y2;
+            break;
+
+        case LCD_LIST_CIRCLE:
+        case LCD_LIST_FILL_CIRCLE:
+            box->xMin = op->x1 - op->x2;
+            box->yMin = op->y1 - op->x2;
+            box->xMax = op->x1 + op->x2;
+            box->yMax = op->y1 + op->x2;
+            break;
+
+        case LCD_LIST_IMAGE:
+            image = op->object;
+            box->xMax = op->x1 + image->xSize - 1;
+            box->yMax = op->y1 + image->ySize - 1;
+            break;
+
+        case LCD_LIST_STRING:
+        case LCD_LIST_STRING_CENTERED:
+            width = Graphics_getStringWidth(context, op->string, op->length);
+            if (op->code == LCD_LIST_STRING_CENTERED)
+            {
+                box->xMin -= width / 2;
+                box->yMin -= context->font->baseline / 2;
+            }
+            box->xMax = box->xMin + width - 1;
+            box->yMax = box->yMin + context->font->height - 1;
+            break;
+
+        case LCD_LIST_STRING_WIDTH:
+            box->xMin -= op->x2 / 2;
+            box->yMin -= context->font->baseline / 2;
+            box->xMax = box->xMin + op->x2 - 1;
+            box->yMax = box->yMin + context->font->height - 1;
+            break;
+    }
+}
+
+static uint8_t Crystalfontz128x128_ScreenOverlap(const Graphics_Rectangle *a,
+                                                 const Graphics_Rectangle *b,
+                                                 int16_t margin)
+{
+    return (a->xMin <= b->xMax + margin) && (b->xMin <= a->xMax + margin) &&
+           (a->yMin <= b->yMax + margin) && (b->yMin <= a->yMax + margin);
+}
+
+//*****************************************************************************
+//
+// Returns nonzero if two drawing ops, each with the context it is drawn
+// with, put the same pixels on the panel.
+//
+//*****************************************************************************
+static uint8_t Crystalfontz128x128_ScreenSame(const Lcd_ListOp *a,
+                                              const Graphics_Context *ca,
+                                              const Lcd_ListOp *b,
+                                              const Graphics_Context *cb)
+{
+    if ((a->code != b->code) || (a->x1 != b->x1) || (a->y1 != b->y1) ||
+        (ca->foreground != cb->foreground) ||
+        (ca->background != cb->background))
+    {
+        return 0;
+    }
+
+    switch (a->code)
+    {
+        case LCD_LIST_LINE:
+        case LCD_LIST_RECT:
+        case LCD_LIST_FILL_RECT:
+            return (a->x2 == b->x2) && (a->y2 == b->y2);
+
+        case LCD_LIST_CIRCLE:
+        case LCD_LIST_FILL_CIRCLE:
+            return a->x2 == b->x2;
+
+        case LCD_LIST_IMAGE:
+            return a->object == b->object;
+
+        case LCD_LIST_STRING_WIDTH:
+            if (a->x2 != b->x2)
+            {
+                return 0;
+            }
+            /* fall through */
+        case LCD_LIST_STRING:
+        case LCD_LIST_STRING_CENTERED:
+            return (ca->font == cb->font) && (a->opaque == b->opaque) &&
+                   (a->length == b->length) &&
+                   (memcmp(a->string, b->string, a->length) == 0);
+
+        default:
+            return 1;
+    }
+}
+
+//*****************************************************************************
+//
+// Returns nonzero if a list can be diffed: it starts with a clear, after
+// state ops only, has no other clear, and at most LCD_SCREEN_OPS drawing
+// ops.  The background of the clear is left in context.
+//
+//*****************************************************************************
+static uint8_t Crystalfontz128x128_ScreenDiffable(const Lcd_DisplayList *list,
+                                                  Graphics_Context *context)
+{
+    Lcd_ListOp op;
+    uint16_t offset;
+    uint8_t clears = 0;
+    uint8_t ops = 0;
+
+    for (offset = 0; offset < list->length; )
+    {
+        offset = Crystalfontz128x128_ListNext(list, offset, &op);
+
+        if (op.code == LCD_LIST_CLEAR)
+        {
+            if (ops || clears++)
+            {
+                return 0;
+            }
+        }
+        else if (Crystalfontz128x128_ScreenDrawing(op.code))
+        {
+            if (!clears || (++ops > LCD_SCREEN_OPS))
+            {
+                return 0;
+            }
+        }
+        else if (!clears)
+        {
+            Crystalfontz128x128_ScreenState(context, &op);
+        }
+    }
+
+    return clears;
+}
+
+//*****************************************************************************
+//
+// Adds a box to the damage, merging it with the boxes it overlaps or
+// touches, or with the last box when there is no room left.
+//
+//*****************************************************************************
+static void Crystalfontz128x128_ScreenDamage(const Graphics_Context *context,
+                                             Graphics_Rectangle box,
+                                             uint8_t erase)
+{
+    uint8_t i;
+
+    if (box.xMin < 0)
+    {
+        box.xMin = 0;
+    }
+    if (box.yMin < 0)
+    {
+        box.yMin = 0;
+    }
+    if (box.xMax >= context->display->width)
+    {
+        box.xMax = context->display->width - 1;
+    }
+    if (box.yMax >= context->display->heigth)
+    {
+        box.yMax = context->display->heigth - 1;
+    }
+    if ((box.xMin > box.xMax) || (box.yMin > box.yMax))
+    {
+        return;
+    }
+
+    i = 0;
+    while (i < Lcd_ScreenBoxes)
+    {
+        if (Crystalfontz128x128_ScreenOverlap(&box, &Lcd_ScreenBox[i], 1) ||
+            ((i == Lcd_ScreenBoxes - 1) &&
+             (Lcd_ScreenBoxes == LCD_SCREEN_BOXES)))
+        {
+            if (Lcd_ScreenBox[i].xMin < box.xMin)
+            {
+                box.xMin = Lcd_ScreenBox[i].xMin;
+            }
+            if (Lcd_ScreenBox[i].yMin < box.yMin)
+            {
+                box.yMin = Lcd_ScreenBox[i].yMin;
+            }
+            if (Lcd_ScreenBox[i].xMax > box.xMax)
+            {
+                box.xMax = Lcd_ScreenBox[i].xMax;
+            }
+            if (Lcd_ScreenBox[i].yMax > box.yMax)
+            {
+                box.yMax = Lcd_ScreenBox[i].yMax;
+            }
+            erase |= Lcd_ScreenErase[i];
+
+            //
+            // The grown box may now reach boxes already passed over.
+            //
+            Lcd_ScreenBoxes--;
+            Lcd_ScreenBox[i] = Lcd_ScreenBox[Lcd_ScreenBoxes];
+            Lcd_ScreenErase[i] = Lcd_ScreenErase[Lcd_ScreenBoxes];
+            i = 0;
+            continue;
+        }
+        i++;
+    }
+
+    Lcd_ScreenBox[Lcd_ScreenBoxes] = box;
+    Lcd_ScreenErase[Lcd_ScreenBoxes] = erase;
+    Lcd_ScreenBoxes++;
+}
+
+//*****************************************************************************
+//
+// Returns nonzero if an unmatched opaque string of the next list covers a
+// box, so the box need not be erased first: the string paints its whole
+// cell box, foreground and background.
+//
+//*****************************************************************************
+static uint8_t Crystalfontz128x128_ScreenCovered(const Lcd_DisplayList *next,
+                                                 const Graphics_Context *context,
+                                                 uint32_t matched,
+                                                 const Graphics_Rectangle *box)
+{
+    Graphics_Context nextState = *context;
+    Graphics_Rectangle opBox;
+    Lcd_ListOp op;
+    uint16_t offset;
+    int8_t i = 0;
+
+    for (offset = 0; offset < next->length; )
+    {
+        offset = Crystalfontz128x128_ListNext(next, offset, &op);
+        Crystalfontz128x128_ScreenState(&nextState, &op);
+        if (!Crystalfontz128x128_ScreenDrawing(op.code))
+        {
+            continue;
+        }
+
+        if (!(matched & (1UL << i)) &&
+            ((op.code == LCD_LIST_STRING) ||
+             (op.code == LCD_LIST_STRING_CENTERED) ||
+             (op.code == LCD_LIST_STRING_WIDTH)) && op.opaque)
+        {
+            Crystalfontz128x128_ScreenOpBox(&nextState, &op, &opBox);
+            if ((opBox.xMin <= box->xMin) && (opBox.yMin <= box->yMin) &&
+                (opBox.xMax >= box->xMax) && (opBox.yMax >= box->yMax))
+            {
+                return 1;
+            }
+        }
+        i++;
+    }
+
+    return 0;
+}
+
+//*****************************************************************************
+//
+// Matches the drawing ops of the next list against those of the shown one,
+// in order, and collects the boxes of the ops left unmatched on either
+// side.  Returns the bit mask of the matched ops of the next list.
+//
+//*****************************************************************************
+static uint32_t Crystalfontz128x128_ScreenDiff(const Lcd_Screen *screen,
+                                               const Lcd_DisplayList *next,
+                                               const Graphics_Context *context)
+{
+    const Lcd_DisplayList *shown = &screen->lists[screen->shown];
+    Graphics_Context nextState = *context;
+    Graphics_Context shownState;
+    Graphics_Rectangle box;
+    Lcd_ListOp op, old;
+    uint32_t nextMatched = 0;
+    uint32_t shownMatched = 0;
+    uint16_t offset, oldOffset;
+    int8_t i, j, last = -1;
+
+    for (offset = 0, i = 0; offset < next->length; )
+    {
+        offset = Crystalfontz128x128_ListNext(next, offset, &op);
+        Crystalfontz128x128_ScreenState(&nextState, &op);
+        if (!Crystalfontz128x128_ScreenDrawing(op.code))
+        {
+            continue;
+        }
+
+        shownState = *context;
+        Crystalfontz128x128_ScreenStart(&shownState, screen->foreground,
+                                        screen->background, screen->font);
+        for (oldOffset = 0, j = 0; oldOffset < shown->length; )
+        {
+            oldOffset = Crystalfontz128x128_ListNext(shown, oldOffset, &old);
+            Crystalfontz128x128_ScreenState(&shownState, &old);
+            if (!Crystalfontz128x128_ScreenDrawing(old.code))
+            {
+                continue;
+            }
+            if ((j > last) &&
+                Crystalfontz128x128_ScreenSame(&op, &nextState, &old,
+                                               &shownState))
+            {
+                nextMatched |= 1UL << i;
+                shownMatched |= 1UL << j;
+                last = j;
+                break;
+            }
+            j++;
+        }
+
+        if (!(nextMatched & (1UL << i)))
+        {
+            Crystalfontz128x128_ScreenOpBox(&nextState, &op, &box);
+            Crystalfontz128x128_ScreenDamage(context, box, 0);
+            Lcd_ScreenCounters.added++;
+        }
+        else
+        {
+            Lcd_ScreenCounters.kept++;
+        }
+        i++;
+    }
+
+    shownState = *context;
+    Crystalfontz128x128_ScreenStart(&shownState, screen->foreground,
+                                    screen->background, screen->font);
+    for (oldOffset = 0, j = 0; oldOffset < shown->length; )
+    {
+        oldOffset = Crystalfontz128x128_ListNext(shown, oldOffset, &old);
+        Crystalfontz128x128_ScreenState(&shownState, &old);
+        if (!Crystalfontz128x128_ScreenDrawing(old.code))
+        {
+            continue;
+        }
+        if (!(shownMatched & (1UL << j)))
+        {
+            Crystalfontz128x128_ScreenOpBox(&shownState, &old, &box);
+            if (Crystalfontz128x128_ScreenCovered(next, context, nextMatched,
+                                                  &box))
+            {
+                Crystalfontz128x128_ScreenDamage(context, box, 0);
+                Lcd_ScreenCounters.overwritten++;
+            }
+            else
+            {
+                Crystalfontz128x128_ScreenDamage(context, box, 1);
+            }
+            Lcd_ScreenCounters.removed++;
+        }
+        j++;
+    }
+
+    return nextMatched;
+}
+
+//*****************************************************************************
+//
+// Redraws one damage box from the next list.  An erased box is cleared and
+// gets every op that reaches into it; a box of added ops only gets the ops
+// from the first added one on, as those before it are already shown.
+//
+//*****************************************************************************
+static void Crystalfontz128x128_ScreenRedraw(const Lcd_DisplayList *next,
+                                             Graphics_Context *context,
+                                             uint32_t matched, uint8_t index)
+{
+    Graphics_Rectangle *box = &Lcd_ScreenBox[index];
+    Graphics_Rectangle opBox;
+    Lcd_ListOp op;
+    uint16_t offset;
+    uint8_t started = Lcd_ScreenErase[index];
+    int8_t i = 0;
+
+    Graphics_setClipRegion(context, box);
+
+    for (offset = 0; offset < next->length; )
+    {
+        offset = Crystalfontz128x128_ListNext(next, offset, &op);
+
+        if (op.code == LCD_LIST_CLEAR)
+        {
+            if (started)
+            {
+                Graphics_fillRectangleOnDisplay(context->display, box,
+                                                context->background);
+            }
+            continue;
+        }
+        if (!Crystalfontz128x128_ScreenDrawing(op.code))
+        {
+            Crystalfontz128x128_ScreenState(context, &op);
+            continue;
+        }
+
+        Crystalfontz128x128_ScreenOpBox(context, &op, &opBox);
+        if (Crystalfontz128x128_ScreenOverlap(&opBox, box, 0))
+        {
+            if (!(matched & (1UL << i)))
+            {
+                started = 1;
+            }
+            if (started)
+            {
+                Crystalfontz128x128_ListDraw(context, &op);
+            }
+        }
+        i++;
+    }
+}
+
+//*****************************************************************************
+//
+//! Shows the next screen.
+//!
+//! \param screen is the retained screen.
+//! \param context is the context to draw on.  A list begun with
+//! Crystalfontz128x128_ScreenBegin() starts from its current colors and font;
+//! one that adds to the screen shown starts from those that screen started
+//! from.  The context is left with those the list sets last.
+//!
+//! If the panel shows the previous list and both lists can be diffed, only
+//! the damage between them is drawn; otherwise the whole list is replayed.
+//! Either way the panel is flushed, and the list becomes the shown one.  A
+//! list that overflowed its buffer is replayed as far as it goes, and the
+//! screen after it is drawn in full.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void Crystalfontz128x128_ScreenShow(Lcd_Screen *screen,
+                                    Graphics_Context *context)
+{
+    Lcd_DisplayList *next = Crystalfontz128x128_ScreenList(screen);
+    Lcd_DisplayList *shown = &screen->lists[screen->shown];
+    Graphics_Rectangle saved = context->clipRegion;
+    Graphics_Context nextState;
+    Graphics_Context shownState;
+    Lcd_ListOp op;
+    uint32_t matched;
+    uint16_t offset;
+    uint8_t index;
+
+    Lcd_ScreenCounters.shown++;
+
+    if (!screen->begun)
+    {
+        Crystalfontz128x128_ScreenStart(context, screen->foreground,
+                                        screen->background, screen->font);
+    }
+    screen->begun = 0;
+
+    nextState = *context;
+    shownState = *context;
+    Crystalfontz128x128_ScreenStart(&shownState, screen->foreground,
+                                    screen->background, screen->font);
+    if (screen->valid && !next->overflow &&
+        Crystalfontz128x128_ScreenDiffable(next, &nextState) &&
+        Crystalfontz128x128_ScreenDiffable(shown, &shownState) &&
+        (nextState.background == shownState.background))
+    {
+        Lcd_ScreenBoxes = 0;
+        matched = Crystalfontz128x128_ScreenDiff(screen, next, context);
+
+        //
+        // Each box is drawn from the start state; nextState keeps it.
+        //
+        nextState = *context;
+        for (index = 0; index < Lcd_ScreenBoxes; index++)
+        {
+            Crystalfontz128x128_ScreenStart(context, nextState.foreground,
+                                            nextState.background,
+                                            nextState.font);
+            Crystalfontz128x128_ScreenRedraw(next, context, matched, index);
+        }
+        Lcd_ScreenCounters.boxes += Lcd_ScreenBoxes;
+
+        //
+        // Leave the context as a full replay would.
+        //
+        Crystalfontz128x128_ScreenStart(context, nextState.foreground,
+                                        nextState.background, nextState.font);
+        for (offset = 0; offset < next->length; )
+        {
+            offset = Crystalfontz128x128_ListNext(next, offset, &op);
+            Crystalfontz128x128_ScreenState(context, &op);
+        }
+    }
+    else
+    {
+        nextState = *context;
+        Crystalfontz128x128_ListReplay(next, context);
+        Lcd_ScreenCounters.fullRedraws++;
+    }
+
+    Graphics_setClipRegion(context, &saved);
+    Graphics_flushBuffer(context);
+
+    screen->foreground = nextState.foreground;
+    screen->background = nextState.background;
+    screen->font = nextState.font;
+    screen->valid = !next->overflow;
+    screen->shown ^= 1;
+
+    //
+    // Ops recorded from here on add to the screen just shown.
+    //
+    memcpy(shown->buffer, next->buffer, next->length);
+    shown->length = next->length;
+    shown->overflow = 0;
+}
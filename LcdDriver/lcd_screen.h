@@ -0,0 +1,69 @@
+// lcd_screen.h
+// Retained screens built on display lists.  The list of the screen on the
+// panel is kept; showing the next one draws only the boxes of the ops that
+// were added, removed or changed, instead of clearing and redrawing it all.
+
+#ifndef LCD_SCREEN_H_
+#define LCD_SCREEN_H_
+
+#include <stdint.h>
+#include "Grlib/grlib/grlib.h"
+#include "LcdDriver/lcd_list.h"
+
+// Drawing ops a screen can be diffed over; longer screens are redrawn whole.
+#define LCD_SCREEN_OPS      32
+
+// Damage boxes kept apart before they are merged.
+#define LCD_SCREEN_BOXES    6
+
+//*****************************************************************************
+//
+// Diff statistics, cumulative until cleared.
+//
+//*****************************************************************************
+typedef struct Lcd_ScreenStats
+{
+    uint16_t shown;         // calls to Crystalfontz128x128_ScreenShow()
+    uint16_t fullRedraws;   // ...that replayed the whole list
+    uint16_t kept;          // drawing ops left on the panel as they were
+    uint16_t added;         // drawing ops new or changed
+    uint16_t removed;       // drawing ops gone or changed
+    uint16_t overwritten;   // ...painted over by opaque text, not erased
+    uint16_t boxes;         // damage boxes redrawn
+} Lcd_ScreenStats;
+
+//*****************************************************************************
+//
+// A retained screen: the list on the panel, the list of the next screen, and
+// the context state the shown list was drawn from.
+//
+//*****************************************************************************
+typedef struct Lcd_Screen
+{
+    Lcd_DisplayList lists[2];
+    uint8_t shown;          // index of the list on the panel
+    uint8_t valid;          // cleared until the panel shows lists[shown]
+    uint8_t begun;          // the next list was begun rather than added to
+    uint32_t foreground;
+    uint32_t background;
+    const Graphics_Font *font;
+} Lcd_Screen;
+
+extern void Crystalfontz128x128_ScreenInit(Lcd_Screen *screen,
+                                           uint8_t *buffer0, uint8_t *buffer1,
+                                           uint16_t size);
+
+extern Lcd_DisplayList *Crystalfontz128x128_ScreenList(Lcd_Screen *screen);
+
+extern void Crystalfontz128x128_ScreenBegin(Lcd_Screen *screen);
+
+extern void Crystalfontz128x128_ScreenShow(Lcd_Screen *screen,
+                                           Graphics_Context *context);
+
+extern void Crystalfontz128x128_ScreenInvalidate(Lcd_Screen *screen);
+
+extern const Lcd_ScreenStats *Crystalfontz128x128_GetScreenStats(void);
+
+extern void Crystalfontz128x128_ClearScreenStats(void);
+
+#endif // LCD_SCREEN_H_
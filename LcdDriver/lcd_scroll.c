@@ -0,0 +1,165 @@
+// lcd_scroll.c
+// Scrolled regions built on the panel's hardware vertical scrolling.
+//
+// The region is a ring of rows in display memory.  Content line l always
+// lives in row top + (l mod height), and the scroll offset selects which
+// line is shown first, so scrolling by n lines only rewrites the n rows
+// whose lines left the screen.  Meant for LCD_ORIENTATION_UP and DOWN,
+// where the hardware scrolls along Y.
+
+#include "Grlib/grlib/grlib.h"
+#include "LcdDriver/lcd_driver.h"
+#include "LcdDriver/lcd_scroll.h"
+#include <stdint.h>
+
+static int16_t Lcd_ScrollTop;
+static int16_t Lcd_ScrollRows;
+
+// Content line shown in the first row of the region.
+static int16_t Lcd_ScrollPos;
+
+// Row of the region that holds content line lLine.
+static int16_t Crystalfontz128x128_ScrollRow(int16_t lLine)
+{
+    int16_t row = lLine % Lcd_ScrollRows;
+
+    if (row < 0)
+    {
+        row += Lcd_ScrollRows;
+    }
+    return Lcd_ScrollTop + row;
+}
+
+//*****************************************************************************
+//
+// Clears the rows holding content lines lLine to lLine + lCount - 1, or,
+// with a redraw callback, draws those lines into them.  The rows are handled
+// in at most two bands, split where the ring wraps.
+//
+//*****************************************************************************
+static void Crystalfontz128x128_ScrollBand(Graphics_Context *context,
+                                           int16_t lLine, int16_t lCount,
+                                           Lcd_ScrollRedraw redraw)
+{
+    Graphics_Rectangle saved = context->clipRegion;
+    Graphics_Rectangle band;
+    int16_t done, chunk;
+
+    for (done = 0; done < lCount; done += chunk)
+    {
+        band.xMin = 0;
+        band.xMax = LCD_HORIZONTAL_MAX - 1;
+        band.yMin = Crystalfontz128x128_ScrollRow(lLine + done);
+        chunk = Lcd_ScrollTop + Lcd_ScrollRows - band.yMin;
+        if (chunk > lCount - done)
+        {
+            chunk = lCount - done;
+        }
+        band.yMax = band.yMin + chunk - 1;
+
+        if (redraw)
+        {
+            Graphics_setClipRegion(context, &band);
+            redraw(context, band.yMin, lLine + done, chunk);
+        }
+        else
+        {
+            Graphics_fillRectangleOnDisplay(context->display, &band,
+                                            context->background);
+        }
+    }
+
+    Graphics_setClipRegion(context, &saved);
+    Graphics_flushBuffer(context);
+}
+
+//*****************************************************************************
+//
+//! Starts scrolling the rows between two fixed areas.
+//!
+//! \param context is a pointer to the drawing context to use.
+//! \param top is the number of rows at the top that stay in place.
+//! \param bottom is the number of rows at the bottom that stay in place.
+//!
+//! What is on screen in the region becomes content lines 0 onwards.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void Crystalfontz128x128_ScrollBegin(Graphics_Context *context,
+                                     int16_t top, int16_t bottom)
+{
+    Graphics_flushBuffer(context);
+
+    Lcd_ScrollTop = top;
+    Lcd_ScrollRows = LCD_VERTICAL_MAX - top - bottom;
+    Lcd_ScrollPos = 0;
+
+    Crystalfontz128x128_SetScrollArea(top, bottom);
+}
+
+//*****************************************************************************
+//
+//! Scrolls the region.
+//!
+//! \param context is a pointer to the drawing context to use.
+//! \param lines is the number of lines to move the content up by, or down
+//! by when negative.
+//! \param redraw is called to draw the lines that come into view.
+//!
+//! The rows that will show the new lines are cleared first, while they are
+//! still scrolling out, then the scroll offset is changed and the new lines
+//! are drawn.  Nothing else in the region is sent again.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void Crystalfontz128x128_ScrollBy(Graphics_Context *context, int16_t lines,
+                                  Lcd_ScrollRedraw redraw)
+{
+    int16_t count = (lines < 0) ? -lines : lines;
+    int16_t first;
+
+    if (count > Lcd_ScrollRows)
+    {
+        count = Lcd_ScrollRows;
+    }
+
+    Lcd_ScrollPos += lines;
+    first = (lines < 0) ? Lcd_ScrollPos :
+                          Lcd_ScrollPos + Lcd_ScrollRows - count;
+
+    Crystalfontz128x128_ScrollBand(context, first, count, 0);
+    Crystalfontz128x128_SetScrollOffset(
+        Crystalfontz128x128_ScrollRow(Lcd_ScrollPos) - Lcd_ScrollTop);
+    Crystalfontz128x128_ScrollBand(context, first, count, redraw);
+}
+
+//*****************************************************************************
+//
+//! Returns the content line shown in the first row of the region.
+//
+//*****************************************************************************
+int16_t Crystalfontz128x128_ScrollPosition(void)
+{
+    return Lcd_ScrollPos;
+}
+
+//*****************************************************************************
+//
+//! Stops scrolling.
+//!
+//! \param context is a pointer to the drawing context to use.
+//!
+//! The panel shows its memory unscrolled again.  Unless the position is a
+//! multiple of the region's height the lines then appear out of order, and
+//! the caller redraws the region.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void Crystalfontz128x128_ScrollEnd(Graphics_Context *context)
+{
+    Graphics_flushBuffer(context);
+    Crystalfontz128x128_ScrollOff();
+}
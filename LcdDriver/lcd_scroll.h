@@ -0,0 +1,34 @@
+// lcd_scroll.h
+// Scrolled regions built on the panel's hardware vertical scrolling.  The
+// contents of the region move without being sent again; only the lines that
+// scroll into view are drawn, by a callback clipped to them.
+
+#ifndef LCD_SCROLL_H_
+#define LCD_SCROLL_H_
+
+#include <stdint.h>
+#include "Grlib/grlib/grlib.h"
+
+//*****************************************************************************
+//
+// Draws lines lLine to lLine + lCount - 1 of the scrolled content.  Line l
+// goes at screen row lY + (l - lLine); the context is clipped to those rows,
+// which have already been cleared to the background color.  Line 0 is the
+// first line of the region before any scrolling.
+//
+//*****************************************************************************
+typedef void (*Lcd_ScrollRedraw)(Graphics_Context *context, int16_t lY,
+                                 int16_t lLine, int16_t lCount);
+
+extern void Crystalfontz128x128_ScrollBegin(Graphics_Context *context,
+                                            int16_t top, int16_t bottom);
+
+extern void Crystalfontz128x128_ScrollBy(Graphics_Context *context,
+                                         int16_t lines,
+                                         Lcd_ScrollRedraw redraw);
+
+extern int16_t Crystalfontz128x128_ScrollPosition(void);
+
+extern void Crystalfontz128x128_ScrollEnd(Graphics_Context *context);
+
+#endif // LCD_SCROLL_H_
@@ -0,0 +1,279 @@
+// lcd_tiles.c
+// Damage-tracking variant of the Crystalfontz128x128 display driver.
+//
+// Every drawing call is passed to the direct driver and marks the 8x8 tiles
+// it covers in a 16x16 bitmap.  A screen in the trainer is a clear followed
+// by drawing, so at the next clear only the marked tiles can differ from the
+// background: they are merged into rectangles and filled, and the rest of
+// the panel is left alone.
+
+#include "Grlib/grlib/grlib.h"
+#include "LcdDriver/lcd_driver.h"
+#include "LcdDriver/lcd_tiles.h"
+#include <stdint.h>
+
+//*****************************************************************************
+//
+// Tiles drawn since the last clear: bit x of Lcd_TileDirty[y] is the tile
+// at column x, row y.
+//
+//*****************************************************************************
+static uint16_t Lcd_TileDirty[LCD_TILES_Y];
+
+// Color the panel was last cleared to, valid once a full clear has been done.
+static uint16_t Lcd_TileBackground;
+static uint8_t Lcd_TileValid;
+
+static Lcd_TileStats Lcd_TileCounters;
+
+static void Crystalfontz128x128_MarkTiles(int16_t lX1, int16_t lY1,
+                                          int16_t lX2, int16_t lY2)
+{
+    uint16_t mask;
+    uint16_t added;
+    int16_t ty;
+
+    mask = (0xFFFF >> (LCD_TILES_X - 1 - lX2 / LCD_TILE_SIZE)) &
+           (0xFFFF << (lX1 / LCD_TILE_SIZE));
+
+    for (ty = lY1 / LCD_TILE_SIZE; ty <= lY2 / LCD_TILE_SIZE; ty++)
+    {
+        added = mask & ~Lcd_TileDirty[ty];
+        if (added)
+        {
+            Lcd_TileDirty[ty] |= added;
+            while (added)
+            {
+                added &= added - 1;
+                Lcd_TileCounters.touched++;
+            }
+        }
+    }
+}
+
+//*****************************************************************************
+//
+//! Resets damage tracking.
+//!
+//! The panel contents are treated as unknown, so the next clear repaints the
+//! whole panel.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void Crystalfontz128x128_TileInit(void)
+{
+    uint8_t ty;
+
+    for (ty = 0; ty < LCD_TILES_Y; ty++)
+    {
+        Lcd_TileDirty[ty] = 0;
+    }
+    Lcd_TileValid = 0;
+}
+
+//*****************************************************************************
+//
+//! Resets damage tracking for a panel known to be filled with one color.
+//!
+//! \param ulColor is the 24-bit RGB color, as passed to
+//! Crystalfontz128x128_InitColor().
+//!
+//! A first clear to the same color then has nothing to repaint.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void Crystalfontz128x128_TileInitColor(uint32_t ulColor)
+{
+    Crystalfontz128x128_TileInit();
+    Lcd_TileBackground =
+        g_sCrystalfontz128x128.callColorTranslate(0, ulColor);
+    Lcd_TileValid = 1;
+}
+
+static void Crystalfontz128x128_TilePixelDraw(void *pvDisplayData,
+                                              int16_t lX, int16_t lY,
+                                              uint16_t ulValue)
+{
+    Crystalfontz128x128_MarkTiles(lX, lY, lX, lY);
+    g_sCrystalfontz128x128.callPixelDraw(pvDisplayData, lX, lY, ulValue);
+}
+
+static void Crystalfontz128x128_TilePixelDrawMultiple(void *pvDisplayData,
+                                                      int16_t lX, int16_t lY,
+                                                      int16_t lX0,
+                                                      int16_t lCount,
+                                                      int16_t lBPP,
+                                                      const uint8_t *pucData,
+                                                      const uint32_t *pucPalette)
+{
+    Crystalfontz128x128_MarkTiles(lX, lY, lX + lCount - 1, lY);
+    g_sCrystalfontz128x128.callPixelDrawMultiple(pvDisplayData, lX, lY, lX0,
+                                                 lCount, lBPP, pucData,
+                                                 pucPalette);
+}
+
+static void Crystalfontz128x128_TileImageBlit(void *pvDisplayData,
+                                              int16_t lX, int16_t lY,
+                                              int16_t lX0, int16_t lWidth,
+                                              int16_t lHeight, int16_t lBPP,
+                                              const uint8_t *pucData,
+                                              int16_t lStride,
+                                              const uint32_t *pucPalette)
+{
+    Crystalfontz128x128_MarkTiles(lX, lY, lX + lWidth - 1, lY + lHeight - 1);
+    g_sCrystalfontz128x128.callImageBlit(pvDisplayData, lX, lY, lX0, lWidth,
+                                         lHeight, lBPP, pucData, lStride,
+                                         pucPalette);
+}
+
+static void Crystalfontz128x128_TileLineDrawH(void *pvDisplayData,
+                                              int16_t lX1, int16_t lX2,
+                                              int16_t lY, uint16_t ulValue)
+{
+    Crystalfontz128x128_MarkTiles(lX1, lY, lX2, lY);
+    g_sCrystalfontz128x128.callLineDrawH(pvDisplayData, lX1, lX2, lY, ulValue);
+}
+
+static void Crystalfontz128x128_TileLineDrawV(void *pvDisplayData,
+                                              int16_t lX, int16_t lY1,
+                                              int16_t lY2, uint16_t ulValue)
+{
+    Crystalfontz128x128_MarkTiles(lX, lY1, lX, lY2);
+    g_sCrystalfontz128x128.callLineDrawV(pvDisplayData, lX, lY1, lY2, ulValue);
+}
+
+static void Crystalfontz128x128_TileRectFill(void *pvDisplayData,
+                                             const Graphics_Rectangle *pRect,
+                                             uint16_t ulValue)
+{
+    Crystalfontz128x128_MarkTiles(pRect->sXMin, pRect->sYMin,
+                                  pRect->sXMax, pRect->sYMax);
+    g_sCrystalfontz128x128.callRectFill(pvDisplayData, pRect, ulValue);
+}
+
+static uint32_t Crystalfontz128x128_TileColorTranslate(void *pvDisplayData,
+                                                       uint32_t ulValue)
+{
+    return g_sCrystalfontz128x128.callColorTranslate(pvDisplayData, ulValue);
+}
+
+static void Crystalfontz128x128_TileFlush(void *pvDisplayData)
+{
+    g_sCrystalfontz128x128.callFlush(pvDisplayData);
+}
+
+//*****************************************************************************
+//
+// Fills the dirty tiles with ulValue, one rectangle at a time.  Each
+// rectangle starts at the first dirty tile left in raster order, takes the
+// run of dirty tiles to its right, and grows downwards while the rows below
+// have that whole run dirty.
+//
+//*****************************************************************************
+static void Crystalfontz128x128_TileRepaint(void *pvDisplayData,
+                                            uint16_t ulValue)
+{
+    Graphics_Rectangle rect;
+    uint16_t run;
+    uint8_t ty, ty2, tx0, tx1;
+
+    for (ty = 0; ty < LCD_TILES_Y; ty++)
+    {
+        while (Lcd_TileDirty[ty])
+        {
+            for (tx0 = 0; !(Lcd_TileDirty[ty] & (1u << tx0)); tx0++);
+            for (tx1 = tx0; (tx1 + 1 < LCD_TILES_X) &&
+                            (Lcd_TileDirty[ty] & (1u << (tx1 + 1))); tx1++);
+
+            run = (0xFFFF >> (LCD_TILES_X - 1 - tx1)) & (0xFFFF << tx0);
+            for (ty2 = ty; (ty2 < LCD_TILES_Y) &&
+                           ((Lcd_TileDirty[ty2] & run) == run); ty2++)
+            {
+                Lcd_TileDirty[ty2] &= ~run;
+                Lcd_TileCounters.flushed += tx1 - tx0 + 1;
+            }
+
+            rect.sXMin = tx0 * LCD_TILE_SIZE;
+            rect.sYMin = ty * LCD_TILE_SIZE;
+            rect.sXMax = (tx1 + 1) * LCD_TILE_SIZE - 1;
+            rect.sYMax = ty2 * LCD_TILE_SIZE - 1;
+            g_sCrystalfontz128x128.callRectFill(pvDisplayData, &rect, ulValue);
+            Lcd_TileCounters.windows++;
+        }
+    }
+}
+
+//*****************************************************************************
+//
+//! Clears the screen to ulValue.
+//!
+//! \param pvDisplayData is a pointer to the driver-specific data for this
+//! display driver.
+//! \param ulValue is the background color.
+//!
+//! When the panel was last cleared to the same color, only the tiles drawn
+//! since then are repainted; otherwise the whole panel is.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static void Crystalfontz128x128_TileClearScreen(void *pvDisplayData,
+                                                uint16_t ulValue)
+{
+    uint8_t ty;
+
+    Lcd_TileCounters.clears++;
+
+    if (Lcd_TileValid && (ulValue == Lcd_TileBackground))
+    {
+        Crystalfontz128x128_TileRepaint(pvDisplayData, ulValue);
+        return;
+    }
+
+    g_sCrystalfontz128x128.callClearDisplay(pvDisplayData, ulValue);
+    for (ty = 0; ty < LCD_TILES_Y; ty++)
+    {
+        Lcd_TileDirty[ty] = 0;
+    }
+    Lcd_TileBackground = ulValue;
+    Lcd_TileValid = 1;
+    Lcd_TileCounters.fullClears++;
+}
+
+const Lcd_TileStats *Crystalfontz128x128_GetTileStats(void)
+{
+    return &Lcd_TileCounters;
+}
+
+void Crystalfontz128x128_ClearTileStats(void)
+{
+    Lcd_TileCounters.clears = 0;
+    Lcd_TileCounters.fullClears = 0;
+    Lcd_TileCounters.touched = 0;
+    Lcd_TileCounters.flushed = 0;
+    Lcd_TileCounters.windows = 0;
+}
+
+//*****************************************************************************
+//
+//! The display structure for the damage-tracking driver.
+//
+//*****************************************************************************
+const Graphics_Display g_sCrystalfontz128x128_Tiles =
+{
+    sizeof(tDisplay),
+    0,
+    LCD_VERTICAL_MAX,
+    LCD_HORIZONTAL_MAX,
+    Crystalfontz128x128_TilePixelDraw,
+    Crystalfontz128x128_TilePixelDrawMultiple,
+    Crystalfontz128x128_TileLineDrawH,
+    Crystalfontz128x128_TileLineDrawV,
+    Crystalfontz128x128_TileRectFill,
+    Crystalfontz128x128_TileColorTranslate,
+    Crystalfontz128x128_TileFlush,
+    Crystalfontz128x128_TileClearScreen,
+    Crystalfontz128x128_TileImageBlit
+};
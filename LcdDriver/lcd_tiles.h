@@ -0,0 +1,41 @@
+// lcd_tiles.h
+// Damage-tracking variant of the Crystalfontz128x128 display driver, for
+// builds without room for the framebuffer.  Drawing goes straight to the
+// panel; the 8x8 tiles it touches are recorded so that the next
+// Graphics_clearDisplay() only repaints what was drawn since the last one.
+
+#ifndef LCD_TILES_H_
+#define LCD_TILES_H_
+
+#include <stdint.h>
+#include "Grlib/grlib/grlib.h"
+
+#define LCD_TILE_SIZE       8
+#define LCD_TILES_X         (128 / LCD_TILE_SIZE)
+#define LCD_TILES_Y         (128 / LCD_TILE_SIZE)
+
+//*****************************************************************************
+//
+// Damage statistics, cumulative until cleared.
+//
+//*****************************************************************************
+typedef struct Lcd_TileStats
+{
+    uint16_t clears;        // calls to Graphics_clearDisplay()
+    uint16_t fullClears;    // ...that had to repaint the whole panel
+    uint32_t touched;       // tiles drawn into, counted once per screen
+    uint32_t flushed;       // tiles repainted by partial clears
+    uint16_t windows;       // address windows the partial clears used
+} Lcd_TileStats;
+
+extern const Graphics_Display g_sCrystalfontz128x128_Tiles;
+
+extern void Crystalfontz128x128_TileInit(void);
+
+extern void Crystalfontz128x128_TileInitColor(uint32_t ulColor);
+
+extern const Lcd_TileStats *Crystalfontz128x128_GetTileStats(void);
+
+extern void Crystalfontz128x128_ClearTileStats(void);
+
+#endif // LCD_TILES_H_
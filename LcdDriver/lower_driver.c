@@ -5,6 +5,23 @@
 #include "Grlib/grlib/grlib.h"
 #include <stdint.h>
 
+// Size of the color pattern a multi-byte fill is sent from, in bytes.  Must
+// be a whole number of pixels (pixel pairs in 12-bit mode) so that every
+// chunk ends on a pixel boundary.
+#ifdef LCD_COLOR_12BIT
+#define HAL_LCD_DMA_PATTERN_BYTES   126
+#else
+#define HAL_LCD_DMA_PATTERN_BYTES   128
+#endif
+
+static volatile uint8_t g_dmaActive;
+static uint16_t g_dmaRemaining;
+static HAL_LCD_DmaCallback g_dmaCallback;
+static uint8_t g_dmaFillByte;
+static uint8_t g_dmaPattern[HAL_LCD_DMA_PATTERN_BYTES];
+static uint16_t g_dmaPatternColor;
+static uint8_t g_dmaPatternValid;
+
 void HAL_LCD_PortInit(void)
 {
     /////////////////////////////////////
@@ -23,6 +40,13 @@ void HAL_LCD_PortInit(void)
     P9DIR |= BIT4;                 // Reset pin
     P2DIR |= BIT3 | BIT5;          // Data/Command and Chip Select pins
 
+    // Backlight (P2.6) is TB0.5, dark until a brightness is set.
+    P2DIR |= BIT6;
+    P2SEL0 |= BIT6;
+    P2SEL1 &= ~BIT6;
+    TB0CCTL5 = OUTMOD_0;
+    HAL_LCD_setTimerPeriod(0);
+
     return;
 }
 
@@ -68,6 +92,9 @@ void HAL_LCD_SpiInit(void)
 
 void HAL_LCD_writeCommand(uint8_t command)
 {
+    // Let any background transfer finish first
+    HAL_LCD_dmaWait();
+
     // Wait as long as the module is busy
     while (UCB0STATW & UCBUSY);
 
@@ -81,17 +108,33 @@ void HAL_LCD_writeCommand(uint8_t command)
 }
 
 
+//*****************************************************************************
+// Raises DC' for data.  DC' may only change once the shift register is empty,
+// so the wait for UCBUSY is needed only when the previous byte was a command;
+// back-to-back data bytes go straight to the transmit buffer.
+//*****************************************************************************
+static void HAL_LCD_enterDataMode(void)
+{
+    if (!(P2OUT & BIT3))
+    {
+        while (UCB0STATW & UCBUSY);
+
+        P2OUT |= BIT3;
+    }
+}
+
+
 //*****************************************************************************
 // Writes a data to the CFAF128128B-0145T.  This function implements the basic SPI
 // interface to the LCD display.
 //*****************************************************************************
 void HAL_LCD_writeData(uint8_t data)
 {
-    // Wait as long as the module is busy
-    while (UCB0STATW & UCBUSY);
+    HAL_LCD_dmaWait();
+    HAL_LCD_enterDataMode();
 
-    // Set DC' bit back to high
-    P2OUT |= BIT3;
+    // Wait for room in the transmit buffer
+    while (!(UCB0IFG & UCTXIFG));
 
     // Transmit data
     UCB0TXBUF = data;
@@ -100,6 +143,405 @@ void HAL_LCD_writeData(uint8_t data)
 }
 
 
+//*****************************************************************************
+// Waits until everything written so far, by the CPU or by DMA, has left the
+// shift register.
+//*****************************************************************************
+void HAL_LCD_txFlush(void)
+{
+    HAL_LCD_dmaWait();
+
+    while (UCB0STATW & UCBUSY);
+}
+
+
+//*****************************************************************************
+// Writes a run of data bytes.  DC' is set once for the whole run and the
+// transmit buffer is refilled as soon as UCTXIFG reports it empty, so the
+// bytes go out back to back.
+//*****************************************************************************
+void HAL_LCD_writeDataBurst(const uint8_t *data, uint16_t count)
+{
+    HAL_LCD_dmaWait();
+    HAL_LCD_enterDataMode();
+
+    while (count--)
+    {
+        while (!(UCB0IFG & UCTXIFG));
+        UCB0TXBUF = *data++;
+    }
+
+    return;
+}
+
+
+//*****************************************************************************
+// Expands a color into the bytes that repeat on the wire for a run of it:
+// one pixel in 16-bit mode, a pair of pixels in 12-bit mode.
+//*****************************************************************************
+#ifdef LCD_COLOR_12BIT
+#define HAL_LCD_COLOR_PERIOD        3
+#else
+#define HAL_LCD_COLOR_PERIOD        2
+#endif
+
+static void HAL_LCD_expandColor(uint16_t color, uint8_t *pattern)
+{
+#ifdef LCD_COLOR_12BIT
+    pattern[0] = color >> 4;
+    pattern[1] = (color << 4) | ((color >> 8) & 0x0F);
+    pattern[2] = color;
+#else
+    pattern[0] = color >> 8;
+    pattern[1] = color;
+#endif
+}
+
+
+//*****************************************************************************
+// Writes count copies of a color.
+//*****************************************************************************
+void HAL_LCD_writeColorRepeat(uint16_t color, uint16_t count)
+{
+    uint8_t pattern[HAL_LCD_COLOR_PERIOD];
+    uint16_t bytes = HAL_LCD_PIXEL_BYTES(count);
+    uint8_t i = 0;
+
+    HAL_LCD_expandColor(color, pattern);
+
+    HAL_LCD_dmaWait();
+    HAL_LCD_enterDataMode();
+
+    while (bytes--)
+    {
+        while (!(UCB0IFG & UCTXIFG));
+        UCB0TXBUF = pattern[i];
+        if (++i == HAL_LCD_COLOR_PERIOD)
+        {
+            i = 0;
+        }
+    }
+
+    return;
+}
+
+
+//*****************************************************************************
+// Writes a buffer of colors, high byte of each first.  In 12-bit mode they
+// are packed in pairs as they go out.
+//*****************************************************************************
+void HAL_LCD_writeColorBuffer(const uint16_t *colors, uint16_t count)
+{
+    uint16_t color;
+
+    HAL_LCD_dmaWait();
+    HAL_LCD_enterDataMode();
+
+#ifdef LCD_COLOR_12BIT
+    for (; count >= 2; count -= 2)
+    {
+        color = *colors++;
+        while (!(UCB0IFG & UCTXIFG));
+        UCB0TXBUF = color >> 4;
+        while (!(UCB0IFG & UCTXIFG));
+        UCB0TXBUF = (color << 4) | ((*colors >> 8) & 0x0F);
+        color = *colors++;
+        while (!(UCB0IFG & UCTXIFG));
+        UCB0TXBUF = color;
+    }
+    if (count)
+    {
+        color = *colors;
+        while (!(UCB0IFG & UCTXIFG));
+        UCB0TXBUF = color >> 4;
+        while (!(UCB0IFG & UCTXIFG));
+        UCB0TXBUF = color << 4;
+    }
+#else
+    while (count--)
+    {
+        color = *colors++;
+        while (!(UCB0IFG & UCTXIFG));
+        UCB0TXBUF = color >> 8;
+        while (!(UCB0IFG & UCTXIFG));
+        UCB0TXBUF = color;
+    }
+#endif
+
+    return;
+}
+
+
+//*****************************************************************************
+// Programs DMA channel 0 to copy count bytes into UCB0TXBUF, one byte per
+// UCB0TXIFG.  srcIncr selects a fixed (DMASRCINCR_0) or incrementing
+// (DMASRCINCR_3) source address.
+//*****************************************************************************
+static void HAL_LCD_dmaStart(const uint8_t *source, uint16_t count,
+                             uint16_t srcIncr)
+{
+    DMA0CTL &= ~DMAEN;
+
+    DMACTL0 = (DMACTL0 & ~DMA0TSEL_31) | DMA0TSEL__UCB0TXIFG0;
+    __data16_write_addr((unsigned short)&DMA0SA, (unsigned long)source);
+    __data16_write_addr((unsigned short)&DMA0DA, (unsigned long)&UCB0TXBUF);
+    DMA0SZ = count;
+    DMA0CTL = DMADT_0 | srcIncr | DMADSTINCR_0 | DMASBDB | DMAIE | DMAEN;
+
+    // The trigger is the rising edge of UCTXIFG, which is already set while
+    // the transmit buffer is empty.  Toggling it issues the first request.
+    // The last byte of a CPU write or of the previous block may still be in
+    // the buffer; the first DMA write would overwrite it, so wait for it to
+    // move to the shift register.
+    while (!(UCB0IFG & UCTXIFG));
+    UCB0IFG &= ~UCTXIFG;
+    UCB0IFG |= UCTXIFG;
+}
+
+
+//*****************************************************************************
+// Handles the end of a DMA block: either queues the next chunk of a pattern
+// fill or retires the transfer and runs the completion callback.
+//*****************************************************************************
+static void HAL_LCD_dmaComplete(void)
+{
+    HAL_LCD_DmaCallback done;
+    uint16_t chunk;
+
+    DMA0CTL &= ~DMAIFG;
+
+    if (g_dmaRemaining)
+    {
+        chunk = (g_dmaRemaining > HAL_LCD_DMA_PATTERN_BYTES) ?
+                HAL_LCD_DMA_PATTERN_BYTES : g_dmaRemaining;
+        g_dmaRemaining -= chunk;
+        HAL_LCD_dmaStart(g_dmaPattern, chunk, DMASRCINCR_3);
+        return;
+    }
+
+    g_dmaActive = 0;
+
+    done = g_dmaCallback;
+    g_dmaCallback = 0;
+    if (done)
+    {
+        done();
+    }
+}
+
+
+//*****************************************************************************
+// Sends count pixels of one color in the background.  When every byte of the
+// color is the same (black, white) a single fixed-source transfer covers the
+// whole fill; otherwise the color is expanded into a pattern buffer that is
+// sent in chunks from the DMA interrupt.  count is limited to 32767 pixels in
+// 16-bit mode and 21845 in 12-bit mode.
+//*****************************************************************************
+void HAL_LCD_dmaFillColor(uint16_t color, uint16_t count,
+                          HAL_LCD_DmaCallback done)
+{
+    uint16_t bytes = HAL_LCD_PIXEL_BYTES(count);
+    uint8_t pattern[HAL_LCD_COLOR_PERIOD];
+    uint16_t chunk;
+    uint16_t i;
+
+    HAL_LCD_dmaWait();
+    HAL_LCD_enterDataMode();
+
+    g_dmaActive = 1;
+    g_dmaCallback = done;
+
+    HAL_LCD_expandColor(color, pattern);
+    for (i = 1; (i < HAL_LCD_COLOR_PERIOD) && (pattern[i] == pattern[0]); i++);
+    if (i == HAL_LCD_COLOR_PERIOD)
+    {
+        g_dmaFillByte = pattern[0];
+        g_dmaRemaining = 0;
+        HAL_LCD_dmaStart(&g_dmaFillByte, bytes, DMASRCINCR_0);
+        return;
+    }
+
+    if (!g_dmaPatternValid || (g_dmaPatternColor != color))
+    {
+        for (i = 0; i < HAL_LCD_DMA_PATTERN_BYTES; i++)
+        {
+            g_dmaPattern[i] = pattern[i % HAL_LCD_COLOR_PERIOD];
+        }
+        g_dmaPatternColor = color;
+        g_dmaPatternValid = 1;
+    }
+
+    chunk = (bytes > HAL_LCD_DMA_PATTERN_BYTES) ?
+            HAL_LCD_DMA_PATTERN_BYTES : bytes;
+    g_dmaRemaining = bytes - chunk;
+    HAL_LCD_dmaStart(g_dmaPattern, chunk, DMASRCINCR_3);
+}
+
+
+//*****************************************************************************
+// Sends count bytes from data in the background.  The buffer is read while
+// the transfer runs and must stay untouched until it completes.
+//*****************************************************************************
+void HAL_LCD_dmaWriteData(const uint8_t *data, uint16_t count,
+                          HAL_LCD_DmaCallback done)
+{
+    HAL_LCD_dmaWait();
+    HAL_LCD_enterDataMode();
+
+    g_dmaActive = 1;
+    g_dmaCallback = done;
+    g_dmaRemaining = 0;
+    HAL_LCD_dmaStart(data, count, DMASRCINCR_3);
+}
+
+
+uint8_t HAL_LCD_dmaBusy(void)
+{
+    return g_dmaActive;
+}
+
+
+//*****************************************************************************
+// Waits for the background transfer to finish.  Completion is normally
+// handled by the DMA interrupt; with interrupts masked the channel is
+// serviced from here instead.
+//*****************************************************************************
+void HAL_LCD_dmaWait(void)
+{
+    while (g_dmaActive)
+    {
+        if (!(__get_SR_register() & GIE) && (DMA0CTL & DMAIFG))
+        {
+            HAL_LCD_dmaComplete();
+        }
+    }
+}
+
+
+//*****************************************************************************
+// Backlight state.  g_blLevel is the brightness in percent; during a fade it
+// moves one step towards g_blTarget every g_blStep SMCLK cycles.
+//*****************************************************************************
+static volatile uint8_t g_blLevel;
+static uint8_t g_blTarget;
+static uint32_t g_blStep;
+static uint32_t g_blElapsed;
+
+// Sets the TB0.5 duty cycle for g_blLevel; 0 and 100% hold the pin still.
+static void HAL_LCD_backlightApply(void)
+{
+    if (g_blLevel == 0)
+    {
+        TB0CCTL5 = OUTMOD_0;
+    }
+    else if (g_blLevel >= 100)
+    {
+        TB0CCTL5 = OUTMOD_0 | OUT;
+    }
+    else
+    {
+        TB0CCR5 = (uint16_t)(((uint32_t)TB0CCR0 + 1) * g_blLevel / 100);
+        TB0CCTL5 = OUTMOD_7;
+    }
+}
+
+
+//*****************************************************************************
+// Sets the backlight brightness at once, ending any fade.
+//*****************************************************************************
+void HAL_LCD_setBacklight(uint8_t percent)
+{
+    TB0CCTL0 &= ~CCIE;
+    g_blLevel = (percent > 100) ? 100 : percent;
+    g_blTarget = g_blLevel;
+    HAL_LCD_backlightApply();
+}
+
+
+//*****************************************************************************
+// Moves the backlight brightness to percent over ms milliseconds, in the
+// background.
+//*****************************************************************************
+void HAL_LCD_fadeBacklight(uint8_t percent, uint16_t ms)
+{
+    uint8_t steps;
+
+    if (percent > 100)
+    {
+        percent = 100;
+    }
+
+    TB0CCTL0 &= ~CCIE;
+    steps = (percent > g_blLevel) ? percent - g_blLevel : g_blLevel - percent;
+    if ((ms == 0) || (steps == 0))
+    {
+        HAL_LCD_setBacklight(percent);
+        return;
+    }
+
+    g_blTarget = percent;
+    g_blStep = (uint32_t)ms * HAL_LCD_SMCLK_PER_MS / steps;
+    g_blElapsed = 0;
+    TB0CCTL0 = CCIE;
+}
+
+
+uint8_t HAL_LCD_getBacklight(void)
+{
+    return g_blLevel;
+}
+
+
+//*****************************************************************************
+// Sets the Timer_B0 period in SMCLK cycles, 0 for the backlight's own.  The
+// counter restarts and the backlight keeps its brightness.
+//
+// The buzzer sets the period of the note it plays, and until it gives the
+// timer back the backlight PWM runs at the note's frequency.  A fade then
+// steps once per note period instead of once per millisecond; it counts
+// SMCLK cycles, so it still takes its length to within one period.
+//*****************************************************************************
+void HAL_LCD_setTimerPeriod(uint16_t period)
+{
+    // In up mode the count runs from 0 to TB0CCR0 inclusive.
+    TB0CCR0 = (period ? period : HAL_LCD_BACKLIGHT_PERIOD) - 1;
+    HAL_LCD_backlightApply();
+    TB0CTL = TBSSEL__SMCLK | MC__UP | TBCLR;
+}
+
+
+#pragma vector=TIMER0_B0_VECTOR
+__interrupt void HAL_LCD_backlightIsr(void)
+{
+    g_blElapsed += (uint32_t)TB0CCR0 + 1;
+    while ((g_blElapsed >= g_blStep) && (g_blLevel != g_blTarget))
+    {
+        g_blElapsed -= g_blStep;
+        g_blLevel += (g_blTarget > g_blLevel) ? 1 : -1;
+    }
+    HAL_LCD_backlightApply();
+
+    if (g_blLevel == g_blTarget)
+    {
+        TB0CCTL0 &= ~CCIE;
+    }
+}
+
+
+#pragma vector=DMA_VECTOR
+__interrupt void HAL_LCD_dmaIsr(void)
+{
+    switch (__even_in_range(DMAIV, DMAIV_DMA2IFG))
+    {
+        case DMAIV_DMA0IFG:
+            HAL_LCD_dmaComplete();
+            break;
+        default:
+            break;
+    }
+}
+
+
 
 
 
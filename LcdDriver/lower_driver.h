@@ -6,10 +6,72 @@
 // Prototypes for the globals exported by this driver.
 //*****************************************************************************
 
+//*****************************************************************************
+// Pixel format on the wire.  Colors are RGB565, two bytes per pixel, unless
+// the build defines LCD_COLOR_12BIT: then they are RGB444 and two pixels are
+// packed into three bytes, RRRRGGGG BBBBRRRR GGGGBBBB.  A run with an odd
+// number of pixels ends in a padding nibble, which the panel drops at the
+// next command.
+//*****************************************************************************
+#ifdef LCD_COLOR_12BIT
+#define HAL_LCD_PIXEL_BYTES(n)      ((uint16_t)(((uint32_t)(n) * 3 + 1) / 2))
+#else
+#define HAL_LCD_PIXEL_BYTES(n)      ((uint16_t)((uint32_t)(n) * 2))
+#endif
+
 extern void HAL_LCD_writeCommand(uint8_t command);
 
 extern void HAL_LCD_writeData(uint8_t data);
 
+extern void HAL_LCD_txFlush(void);
+
+extern void HAL_LCD_writeDataBurst(const uint8_t *data, uint16_t count);
+
+extern void HAL_LCD_writeColorRepeat(uint16_t color, uint16_t count);
+
+extern void HAL_LCD_writeColorBuffer(const uint16_t *colors, uint16_t count);
+
+//*****************************************************************************
+// DMA transport for large RAMWR payloads (channel 0, triggered by UCB0TXIFG).
+// A transfer runs in the background; every other HAL_LCD_* call waits for it
+// to finish first, so the order of bytes on the bus is preserved.  The
+// callback, if any, runs from the DMA interrupt once the last byte has been
+// handed to the eUSCI; HAL_LCD_txFlush() waits until it has left the wire.
+//*****************************************************************************
+typedef void (*HAL_LCD_DmaCallback)(void);
+
+extern void HAL_LCD_dmaFillColor(uint16_t color, uint16_t count,
+                                 HAL_LCD_DmaCallback done);
+
+extern void HAL_LCD_dmaWriteData(const uint8_t *data, uint16_t count,
+                                 HAL_LCD_DmaCallback done);
+
+extern uint8_t HAL_LCD_dmaBusy(void);
+
+extern void HAL_LCD_dmaWait(void);
+
+//*****************************************************************************
+// Backlight PWM on P2.6 (TB0.5).  Timer_B0 runs from SMCLK in up mode with a
+// period of HAL_LCD_BACKLIGHT_PERIOD; the buzzer on TB0.6 shares the timer
+// and changes the period while a note plays, and the duty cycle is rescaled
+// to match.  Fades step the brightness from the CCR0 interrupt, once per
+// period.
+//*****************************************************************************
+#ifndef HAL_LCD_SMCLK_HZ
+#define HAL_LCD_SMCLK_HZ            16000000UL  // as set up in trainer_hw.c
+#endif
+#define HAL_LCD_SMCLK_PER_MS        (HAL_LCD_SMCLK_HZ / 1000)
+
+#define HAL_LCD_BACKLIGHT_PERIOD    HAL_LCD_SMCLK_PER_MS    // 1 kHz
+
+extern void HAL_LCD_setBacklight(uint8_t percent);
+
+extern void HAL_LCD_fadeBacklight(uint8_t percent, uint16_t ms);
+
+extern uint8_t HAL_LCD_getBacklight(void);
+
+extern void HAL_LCD_setTimerPeriod(uint16_t period);
+
 extern void HAL_LCD_PortInit(void);
 
 extern void HAL_LCD_SpiInit(void);  // Uses eUSCI #0 Channel B
@@ -0,0 +1,633 @@
+// font_compiler.c
+// Build-time converter from BDF fonts to grlib font sources.  Each glyph is
+// drawn into its character cell and encoded both ways grlib can draw it: as
+// an uncompressed bit stream, which decodes a bit at a time, and as
+// PIXEL_RLE runs, which decode a run at a time.  A font has one format, so
+// the one that is smaller over all its glyphs is used unless one is asked
+// for; the report lists every glyph in both, so the FRAM a format costs can
+// be weighed against the reads it takes to draw.
+//
+// Characters 32 to 126 give a Graphics_Font; any other range a
+// Graphics_FontEx.  Characters the BDF lacks share the glyph of '.', as
+// grlib draws characters outside the font.  The advance width table and
+// fixed-width flag are written as font_metrics.c writes them.  PCF fonts can
+// be converted to BDF with pcf2bdf first.
+//
+// Usage: font_compiler [-f uncompressed|rle|smallest] [-r first-last]
+//                      [-n Name] font.bdf output
+// writes output.c, defining g_sFont<Name>, and prints the report.
+
+#ifndef __MSP430__
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "gen_util.h"
+
+#define GEN_CHARS       256
+#define GEN_CELL_PIXELS (255 * 8)   // a glyph's length is a byte
+#define GEN_GLYPH_BYTES 255
+
+#define GEN_UNCOMPRESSED    0
+#define GEN_RLE             1
+#define GEN_SMALLEST        2
+
+typedef struct Gen_Glyph
+{
+    uint8_t present;
+    uint8_t width;                      // the advance
+    uint8_t cell[GEN_CELL_PIXELS];      // width x height, row by row
+    uint8_t bytes[2][GEN_GLYPH_BYTES];  // uncompressed and RLE, headers in
+    int16_t length[2];                  // -1 if the glyph does not fit
+    uint16_t reads[2];                  // bits or run codes read to draw it
+} Gen_Glyph;
+
+static Gen_Glyph g_glyphs[GEN_CHARS];
+static int g_ascent, g_descent, g_height;
+static char g_family[128] = "unnamed";
+static int g_pointSize;
+
+//*****************************************************************************
+//
+// Reads the BDF font, drawing each glyph into its cell: advance wide and
+// ascent plus descent high, with the baseline at the ascent.
+//
+//*****************************************************************************
+static int Gen_readBdf(FILE *f)
+{
+    char line[512];
+    int code = -1, bbw = 0, bbh = 0, bbx = 0, bby = 0, row = -1;
+    int fbw = 0, fbh = 0, fbx = 0, fby = 0;
+    int x, y, px, value;
+    Gen_Glyph *glyph = 0;
+
+    g_ascent = g_descent = -1;
+
+    while (fgets(line, sizeof(line), f))
+    {
+        if (row >= 0)
+        {
+            if (!strncmp(line, "ENDCHAR", 7))
+            {
+                row = -1;
+                glyph = 0;
+                continue;
+            }
+            if (glyph && (row < bbh))
+            {
+                //
+                // A row of the bitmap in hex, most significant bit first.
+                //
+                y = g_ascent - (bby + bbh) + row;
+                for (x = 0; x < bbw; x++)
+                {
+                    if (!isxdigit((unsigned char)line[x / 4]))
+                    {
+                        break;
+                    }
+                    value = (line[x / 4] <= '9') ? (line[x / 4] - '0') :
+                            ((toupper((unsigned char)line[x / 4]) - 'A') + 10);
+                    px = bbx + x;
+                    if (((value >> (3 - (x & 3))) & 1) && (px >= 0) &&
+                        (px < glyph->width) && (y >= 0) && (y < g_height))
+                    {
+                        glyph->cell[(y * glyph->width) + px] = 1;
+                    }
+                }
+            }
+            row++;
+            continue;
+        }
+
+        if (!strncmp(line, "FAMILY_NAME ", 12))
+        {
+            sscanf(line + 12, " \"%127[^\"]\"", g_family);
+        }
+        else if (!strncmp(line, "POINT_SIZE ", 11))
+        {
+            g_pointSize = atoi(line + 11) / 10;
+        }
+        else if (!strncmp(line, "FONT_ASCENT ", 12))
+        {
+            g_ascent = atoi(line + 12);
+        }
+        else if (!strncmp(line, "FONT_DESCENT ", 13))
+        {
+            g_descent = atoi(line + 13);
+        }
+        else if (!strncmp(line, "FONTBOUNDINGBOX ", 16))
+        {
+            sscanf(line + 16, "%d %d %d %d", &fbw, &fbh, &fbx, &fby);
+        }
+        else if (!strncmp(line, "ENDPROPERTIES", 13) ||
+                 !strncmp(line, "CHARS ", 6))
+        {
+            if (g_ascent < 0)
+            {
+                g_ascent = fbh + fby;
+            }
+            if (g_descent < 0)
+            {
+                g_descent = -fby;
+            }
+            g_height = g_ascent + g_descent;
+        }
+        else if (!strncmp(line, "ENCODING ", 9))
+        {
+            code = atoi(line + 9);
+            glyph = ((code >= 0) && (code < GEN_CHARS)) ? &g_glyphs[code] : 0;
+            bbw = fbw;
+            bbh = fbh;
+            bbx = fbx;
+            bby = fby;
+        }
+        else if (!strncmp(line, "DWIDTH ", 7) && glyph)
+        {
+            value = atoi(line + 7);
+            glyph->width = (value < 0) ? 0 : (value > 255) ? 255 : value;
+        }
+        else if (!strncmp(line, "BBX ", 4))
+        {
+            sscanf(line + 4, "%d %d %d %d", &bbw, &bbh, &bbx, &bby);
+        }
+        else if (!strncmp(line, "BITMAP", 6))
+        {
+            if (glyph)
+            {
+                if ((g_height <= 0) || (glyph->width * g_height >
+                                        GEN_CELL_PIXELS))
+                {
+                    fprintf(stderr, "font_compiler: glyph %d too large\n",
+                            code);
+                    return -1;
+                }
+                memset(glyph->cell, 0, sizeof(glyph->cell));
+                glyph->present = 1;
+            }
+            row = 0;
+        }
+    }
+
+    if (g_height <= 0)
+    {
+        fprintf(stderr, "font_compiler: no font metrics\n");
+        return -1;
+    }
+    return 0;
+}
+
+//*****************************************************************************
+//
+// Encodes a glyph as a bit stream covering the whole cell.
+//
+//*****************************************************************************
+static void Gen_encodeUncompressed(Gen_Glyph *glyph)
+{
+    int pixels = glyph->width * g_height;
+    int bytes = 2 + ((pixels + 7) / 8);
+    int i;
+
+    if (bytes > GEN_GLYPH_BYTES)
+    {
+        glyph->length[GEN_UNCOMPRESSED] = -1;
+        return;
+    }
+
+    memset(glyph->bytes[GEN_UNCOMPRESSED], 0, bytes);
+    glyph->bytes[GEN_UNCOMPRESSED][0] = bytes;
+    glyph->bytes[GEN_UNCOMPRESSED][1] = glyph->width;
+    for (i = 0; i < pixels; i++)
+    {
+        if (glyph->cell[i])
+        {
+            glyph->bytes[GEN_UNCOMPRESSED][2 + (i / 8)] |= 0x80 >> (i & 7);
+        }
+    }
+    glyph->length[GEN_UNCOMPRESSED] = bytes;
+    glyph->reads[GEN_UNCOMPRESSED] = pixels;
+}
+
+//*****************************************************************************
+//
+// Appends a byte to an RLE glyph; returns nonzero if there is no room.
+//
+//*****************************************************************************
+static int Gen_put(Gen_Glyph *glyph, int *length, uint8_t value)
+{
+    if (*length >= GEN_GLYPH_BYTES)
+    {
+        return 1;
+    }
+    glyph->bytes[GEN_RLE][(*length)++] = value;
+    return 0;
+}
+
+//*****************************************************************************
+//
+// Encodes a glyph as PIXEL_RLE runs: a byte of up to 15 off pixels then up
+// to 15 on, or a zero byte and a count of 8 pixel groups, on if its top bit
+// is set.  The off pixels after the last on one are left out.
+//
+//*****************************************************************************
+static void Gen_encodeRle(Gen_Glyph *glyph)
+{
+    int pixels = glyph->width * g_height;
+    int length = 2, codes = 0, i = 0, off, on, groups, full = 0;
+
+    while (pixels && !glyph->cell[pixels - 1])
+    {
+        pixels--;
+    }
+
+    while ((i < pixels) && !full)
+    {
+        for (off = 0; (i < pixels) && !glyph->cell[i]; i++, off++)
+        {
+        }
+        for (on = 0; (i < pixels) && glyph->cell[i]; i++, on++)
+        {
+        }
+
+        while (off > 15)
+        {
+            groups = (off / 8 > 127) ? 127 : off / 8;
+            full |= Gen_put(glyph, &length, 0);
+            full |= Gen_put(glyph, &length, groups);
+            off -= groups * 8;
+            codes++;
+        }
+        while (on > 15)
+        {
+            //
+            // Send what is left of the off run with the odd on pixels, then
+            // the rest of the on run in groups.
+            //
+            groups = ((on - (on % 8)) / 8 > 127) ? 127 : (on - (on % 8)) / 8;
+            if (off || (on % 8))
+            {
+                full |= Gen_put(glyph, &length, (off << 4) | (on % 8));
+                codes++;
+                on -= on % 8;
+                off = 0;
+            }
+            full |= Gen_put(glyph, &length, 0);
+            full |= Gen_put(glyph, &length, 0x80 | groups);
+            on -= groups * 8;
+            codes++;
+        }
+        if (off || on)
+        {
+            full |= Gen_put(glyph, &length, (off << 4) | on);
+            codes++;
+        }
+    }
+
+    if (full)
+    {
+        glyph->length[GEN_RLE] = -1;
+        return;
+    }
+    glyph->bytes[GEN_RLE][0] = length;
+    glyph->bytes[GEN_RLE][1] = glyph->width;
+    glyph->length[GEN_RLE] = length;
+    glyph->reads[GEN_RLE] = codes;
+}
+
+int main(int argc, char *argv[])
+{
+    static uint8_t data[65536];
+    uint16_t offsets[GEN_CHARS];
+    uint16_t dataOffset[GEN_CHARS];
+    uint8_t widths[GEN_CHARS];
+    const char *input = 0, *output = 0, *name = 0, *formatName;
+    int first = 32, last = 126, format = GEN_SMALLEST, ex, fixed;
+    long total[2] = { 0, 0 }, reads[2] = { 0, 0 }, size, dataBytes = 0;
+    int absent, c, i, maxWidth = 0;
+    char path[512];
+    FILE *f;
+
+    for (i = 1; i < argc; i++)
+    {
+        if (!strcmp(argv[i], "-f") && (i + 1 < argc))
+        {
+            i++;
+            format = !strcmp(argv[i], "uncompressed") ? GEN_UNCOMPRESSED :
+                     !strcmp(argv[i], "rle") ? GEN_RLE :
+                     !strcmp(argv[i], "smallest") ? GEN_SMALLEST : -1;
+        }
+        else if (!strcmp(argv[i], "-r") && (i + 1 < argc))
+        {
+            if (sscanf(argv[++i], "%d-%d", &first, &last) != 2)
+            {
+                first = -1;
+            }
+        }
+        else if (!strcmp(argv[i], "-n") && (i + 1 < argc))
+        {
+            name = argv[++i];
+        }
+        else if (!input)
+        {
+            input = argv[i];
+        }
+        else if (!output)
+        {
+            output = argv[i];
+        }
+        else
+        {
+            output = 0;
+            break;
+        }
+    }
+    if (!input || !output || (format < 0) || (first < 0) ||
+        (last >= GEN_CHARS) || (first > last))
+    {
+        fprintf(stderr, "usage: font_compiler [-f uncompressed|rle|smallest] "
+                        "[-r first-last] [-n Name] font.bdf output\n");
+        return 1;
+    }
+    if (!name)
+    {
+        name = strrchr(output, '/') ? strrchr(output, '/') + 1 : output;
+    }
+    ex = (first != 32) || (last != 126);
+
+    f = fopen(input, "r");
+    if (!f)
+    {
+        fprintf(stderr, "font_compiler: cannot read %s\n", input);
+        return 1;
+    }
+    c = Gen_readBdf(f);
+    fclose(f);
+    if (c < 0)
+    {
+        return 1;
+    }
+
+    //
+    // Characters missing from the BDF draw as '.', or as the first character
+    // there is if '.' is missing too.
+    //
+    absent = '.';
+    if ((absent < first) || (absent > last) || !g_glyphs[absent].present)
+    {
+        for (absent = first; (absent <= last) && !g_glyphs[absent].present;
+             absent++)
+        {
+        }
+        if (absent > last)
+        {
+            fprintf(stderr, "font_compiler: no characters %d to %d in %s\n",
+                    first, last, input);
+            return 1;
+        }
+    }
+
+    printf("%s: %s, %d pixels high, baseline %d\n\n", input, g_family,
+           g_height, g_ascent);
+    printf("char  width  uncompressed  reads   rle  reads\n");
+    for (c = first; c <= last; c++)
+    {
+        Gen_Glyph *glyph = &g_glyphs[c];
+
+        if (!glyph->present)
+        {
+            continue;
+        }
+        Gen_encodeUncompressed(glyph);
+        Gen_encodeRle(glyph);
+        for (i = 0; i < 2; i++)
+        {
+            total[i] += glyph->length[i];
+            reads[i] += glyph->reads[i];
+        }
+        if (glyph->width > maxWidth)
+        {
+            maxWidth = glyph->width;
+        }
+        printf("%3d %c  %5d  %12d  %5d  %4d  %5d\n", c,
+               isprint(c) ? c : ' ', glyph->width,
+               glyph->length[GEN_UNCOMPRESSED], glyph->reads[GEN_UNCOMPRESSED],
+               glyph->length[GEN_RLE], glyph->reads[GEN_RLE]);
+    }
+
+    //
+    // A format one of the glyphs does not fit is out.
+    //
+    for (c = first; c <= last; c++)
+    {
+        for (i = 0; i < 2; i++)
+        {
+            if (g_glyphs[c].present && (g_glyphs[c].length[i] < 0))
+            {
+                total[i] = -1;
+            }
+        }
+    }
+    if (format == GEN_SMALLEST)
+    {
+        format = ((total[GEN_RLE] >= 0) &&
+                  ((total[GEN_UNCOMPRESSED] < 0) ||
+                   (total[GEN_RLE] < total[GEN_UNCOMPRESSED]))) ?
+                 GEN_RLE : GEN_UNCOMPRESSED;
+    }
+    if (total[format] < 0)
+    {
+        fprintf(stderr, "font_compiler: a glyph is too large to encode %s\n",
+                format ? "as RLE" : "uncompressed");
+        return 1;
+    }
+    formatName = (format == GEN_RLE) ? "PIXEL_RLE" : "UNCOMPRESSED";
+
+    //
+    // Lay the glyphs out, sharing the absent glyph.
+    //
+    for (c = first; c <= last; c++)
+    {
+        Gen_Glyph *glyph = &g_glyphs[g_glyphs[c].present ? c : absent];
+
+        if (!g_glyphs[c].present && (c != absent))
+        {
+            continue;
+        }
+        if (dataBytes + glyph->length[format] > 65535)
+        {
+            fprintf(stderr, "font_compiler: more than 64 KB of glyphs\n");
+            return 1;
+        }
+        dataOffset[c] = dataBytes;
+        memcpy(data + dataBytes, glyph->bytes[format], glyph->length[format]);
+        dataBytes += glyph->length[format];
+    }
+    fixed = 1;
+    for (c = first; c <= last; c++)
+    {
+        offsets[c] = dataOffset[g_glyphs[c].present ? c : absent];
+        widths[c] = g_glyphs[g_glyphs[c].present ? c : absent].width;
+        fixed = fixed && (widths[c] == maxWidth);
+    }
+
+    size = dataBytes + (2 * (last - first + 1)) + (last - first + 1) +
+           (ex ? 16 : 204);
+    printf("\n%d glyphs: uncompressed %ld bytes, %ld reads; "
+           "rle %ld bytes, %ld reads\n", last - first + 1,
+           total[GEN_UNCOMPRESSED], reads[GEN_UNCOMPRESSED], total[GEN_RLE],
+           reads[GEN_RLE]);
+    printf("writing %s: %ld bytes of glyphs, about %ld in all%s\n", formatName,
+           dataBytes, size, fixed ? ", fixed width" : "");
+
+    snprintf(path, sizeof(path), "%s.c", output);
+    f = fopen(path, "w");
+    if (!f)
+    {
+        fprintf(stderr, "font_compiler: cannot write %s\n", path);
+        return 1;
+    }
+
+    fprintf(f, "//*****************************************************************************\n"
+               "//\n"
+               "// This file is generated by host/font_compiler.c from %s;\n"
+               "// DO NOT EDIT BY HAND!\n"
+               "//\n"
+               "//*****************************************************************************\n"
+               "\n"
+               "#include \"Grlib/grlib/grlib.h\"\n"
+               "\n"
+               "//*****************************************************************************\n"
+               "//\n"
+               "// Details of this font:\n"
+               "//     Characters: %d to %d inclusive\n"
+               "//     Style: %s\n"
+               "//     Size: %d point\n"
+               "//     Memory usage: %ld bytes\n"
+               "//\n"
+               "//*****************************************************************************\n"
+               "\n"
+               "//*****************************************************************************\n"
+               "//\n"
+               "// The %s data for the %s font.\n"
+               "//\n"
+               "//*****************************************************************************\n"
+               "static const uint8_t g_pucFont%sData[%ld] =\n"
+               "{",
+            strrchr(input, '/') ? strrchr(input, '/') + 1 : input,
+            first, last, g_family, g_pointSize, size,
+            (format == GEN_RLE) ? "compressed" : "uncompressed", name, name,
+            dataBytes);
+    Gen_writeBytes(f, data, dataBytes);
+    fprintf(f, "\n};\n\n");
+
+    if (ex)
+    {
+        fprintf(f, "//*****************************************************************************\n"
+                   "//\n"
+                   "// The offset to each character in the font.\n"
+                   "//\n"
+                   "//*****************************************************************************\n"
+                   "static const uint16_t g_pusFont%sOffset[%d] =\n"
+                   "{", name, last - first + 1);
+        for (c = first; c <= last; c++)
+        {
+            fprintf(f, "%s%5u,", ((c - first) % 8) ? " " : "\n    ",
+                    offsets[c]);
+        }
+        fprintf(f, "\n};\n\n");
+    }
+
+    fprintf(f, "//*****************************************************************************\n"
+               "//\n"
+               "// The advance width of each character in the font.\n"
+               "//\n"
+               "//*****************************************************************************\n"
+               "static const uint8_t g_pucFont%sWidths[%d] =\n"
+               "{", name, last - first + 1);
+    Gen_writeBytes(f, widths + first, last - first + 1);
+    fprintf(f, "\n};\n\n");
+
+    fprintf(f, "//*****************************************************************************\n"
+               "//\n"
+               "// The font definition for the %s font.\n"
+               "//\n"
+               "//*****************************************************************************\n"
+               "const Graphics_Font%s g_sFont%s%s =\n"
+               "{\n"
+               "    //\n"
+               "    // The format of the font.\n"
+               "    //\n"
+               "    GRAPHICS_FONT_FMT_%s%s,\n"
+               "\n"
+               "    //\n"
+               "    // The maximum width of the font.\n"
+               "    //\n"
+               "    %d,\n"
+               "\n"
+               "    //\n"
+               "    // The height of the font.\n"
+               "    //\n"
+               "    %d,\n"
+               "\n"
+               "    //\n"
+               "    // The baseline of the font.\n"
+               "    //\n"
+               "    %d,\n"
+               "\n",
+            name, ex ? "Ex" : "", name, ex ? "Ex" : "", ex ? "EX_" : "",
+            formatName, maxWidth, g_height, g_ascent);
+
+    if (ex)
+    {
+        fprintf(f, "    //\n"
+                   "    // The first and last characters in the font.\n"
+                   "    //\n"
+                   "    %d,\n"
+                   "    %d,\n"
+                   "\n"
+                   "    //\n"
+                   "    // A pointer to the offset to each character in the "
+                   "font.\n"
+                   "    //\n"
+                   "    g_pusFont%sOffset,\n"
+                   "\n", first, last, name);
+    }
+    else
+    {
+        fprintf(f, "    //\n"
+                   "    // The offset to each character in the font.\n"
+                   "    //\n"
+                   "    {");
+        for (c = first; c <= last; c++)
+        {
+            fprintf(f, "%s%5u,", ((c - first) % 8) ? " " : "\n        ",
+                    offsets[c]);
+        }
+        fprintf(f, "\n    },\n\n");
+    }
+
+    fprintf(f, "    //\n"
+               "    // A pointer to the actual font data\n"
+               "    //\n"
+               "    g_pucFont%sData,\n"
+               "\n"
+               "    //\n"
+               "    // A pointer to the advance width of each character.\n"
+               "    //\n"
+               "    g_pucFont%sWidths,\n"
+               "\n"
+               "    //\n"
+               "    // Whether every character is the maximum width.\n"
+               "    //\n"
+               "    %s\n"
+               "};\n", name, name, fixed ? "true" : "false");
+    fclose(f);
+
+    printf("declare it with: extern const Graphics_Font%s g_sFont%s%s;\n",
+           ex ? "Ex" : "", name, ex ? "Ex" : "");
+    return 0;
+}
+
+#endif // __MSP430__
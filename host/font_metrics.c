@@ -0,0 +1,227 @@
+// font_metrics.c
+// Build-time glyph metrics for the grlib fonts.  Each font is linked in and
+// the advance width of every character read from its glyph headers; the
+// widths are then written back into the font's source as a flat table, with
+// the fixed-width flag set if they are all the font's maximum width, so that
+// Graphics_getStringWidth() need not touch the glyph data.  Running it again
+// replaces what it wrote before.
+//
+// Usage: font_metrics ../GrLib/fonts    (make font-metrics)
+
+#ifndef __MSP430__
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "Grlib/grlib/grlib.h"
+#include "gen_util.h"
+
+#define GEN_SOURCE_BYTES    (256 * 1024)
+#define GEN_CHARS           95      // 32 to 126, as Graphics_Font holds
+
+typedef struct Gen_Font
+{
+    const char *file;
+    const Graphics_Font *font;
+} Gen_Font;
+
+static const Gen_Font g_fonts[] =
+{
+    { "fontClean5x8.c", &g_sFontclean5x8 },
+    { "fontClean7x10.c", &g_sFontclean7x10 },
+    { "fontCourier7x13.c", &g_sFontcourier7x13 },
+    { "fontCourier7x13b.c", &g_sFontcourier7x13b },
+    { "fontFixed7x13.c", &g_sFontfixed7x13 },
+    { "fontLucidabright6x12.c", &g_sFontlucidabright6x12 },
+    { "fontLucidasans6x11.c", &g_sFontlucidasans6x11 },
+    { "fontLucidasans8x15.c", &g_sFontlucidasans8x15 },
+    { "fontcm12.c", &g_sFontCm12 },
+    { "fontcm12b.c", &g_sFontCm12b },
+    { "fontcm16.c", &g_sFontCm16 },
+    { "fontcmss12.c", &g_sFontCmss12 },
+    { "fontcmtt12.c", &g_sFontCmtt12 },
+    { "fontfixed6x8.c", &g_sFontFixed6x8 },
+};
+
+// The head of the table block, by which an earlier one is found.
+static const char g_banner[] =
+    "//*****************************************************************************\n"
+    "//\n"
+    "// The advance width of each character in the font.\n";
+
+static char g_source[GEN_SOURCE_BYTES];
+
+//*****************************************************************************
+//
+// Copies the identifier at p into name.
+//
+//*****************************************************************************
+static void Gen_identifier(const char *p, char *name, size_t size)
+{
+    size_t i;
+
+    for (i = 0; (i < size - 1) &&
+                (((p[i] >= 'a') && (p[i] <= 'z')) ||
+                 ((p[i] >= 'A') && (p[i] <= 'Z')) ||
+                 ((p[i] >= '0') && (p[i] <= '9')) || (p[i] == '_')); i++)
+    {
+        name[i] = p[i];
+    }
+    name[i] = 0;
+}
+
+//*****************************************************************************
+//
+// Rewrites one font source with the widths of its font.
+//
+//*****************************************************************************
+static int Gen_font(const char *dir, const Gen_Font *gen)
+{
+    const Graphics_Font *font = gen->font;
+    char path[512], dataName[64], widthsName[64], indent[32];
+    const char *decl, *def, *data, *close, *line, *start, *head;
+    uint8_t widths[GEN_CHARS];
+    bool fixed = true;
+    size_t bytes;
+    FILE *f;
+    int i;
+
+    for (i = 0; i < GEN_CHARS; i++)
+    {
+        widths[i] = font->data[font->offset[i] + 1];
+        fixed = fixed && (widths[i] == font->maxWidth);
+    }
+
+    snprintf(path, sizeof(path), "%s/%s", dir, gen->file);
+    f = fopen(path, "r");
+    if (!f)
+    {
+        fprintf(stderr, "font_metrics: cannot read %s\n", path);
+        return -1;
+    }
+    bytes = fread(g_source, 1, sizeof(g_source) - 1, f);
+    fclose(f);
+    g_source[bytes] = 0;
+
+    //
+    // The glyph data array names the table, and the font definition is
+    // where it goes.
+    //
+    decl = strstr(g_source, "static const uint8_t ");
+    def = strstr(g_source, "\nconst tFont ");
+    if (!def)
+    {
+        def = strstr(g_source, "\nconst Graphics_Font ");
+    }
+    if (!decl || !def)
+    {
+        fprintf(stderr, "font_metrics: no font in %s\n", path);
+        return -1;
+    }
+    Gen_identifier(decl + strlen("static const uint8_t "), dataName,
+                   sizeof(dataName));
+    bytes = strlen(dataName);
+    if ((bytes < 5) || strcmp(dataName + bytes - 4, "Data"))
+    {
+        fprintf(stderr, "font_metrics: no glyph data in %s\n", path);
+        return -1;
+    }
+    snprintf(widthsName, sizeof(widthsName), "%.*sWidths", (int)(bytes - 4),
+             dataName);
+
+    //
+    // Find the data pointer in the definition, and the brace after it.
+    //
+    data = strstr(def, dataName);
+    close = data ? strchr(data, '}') : 0;
+    if (!close)
+    {
+        fprintf(stderr, "font_metrics: no data pointer in %s\n", path);
+        return -1;
+    }
+    for (line = data; (line > def) && (line[-1] != '\n'); line--)
+    {
+    }
+    snprintf(indent, sizeof(indent), "%.*s", (int)(data - line), line);
+
+    //
+    // The table goes before the comment block over the definition, in place
+    // of the one written by an earlier run.
+    //
+    for (start = def + 1; ; start = line)
+    {
+        for (line = start - 1; (line > g_source) && (line[-1] != '\n');
+             line--)
+        {
+        }
+        if ((line == start - 1) || strncmp(line, "//", 2))
+        {
+            break;
+        }
+    }
+    head = strstr(g_source, g_banner);
+    if (!head || (head > start))
+    {
+        head = start;
+    }
+
+    f = fopen(path, "w");
+    if (!f)
+    {
+        fprintf(stderr, "font_metrics: cannot write %s\n", path);
+        return -1;
+    }
+
+    fwrite(g_source, 1, head - g_source, f);
+    fprintf(f, "%s"
+               "//\n"
+               "//*****************************************************************************\n"
+               "static const uint8_t %s[%d] =\n"
+               "{", g_banner, widthsName, GEN_CHARS);
+    Gen_writeBytes(f, widths, GEN_CHARS);
+    fprintf(f, "\n};\n\n");
+
+    fwrite(start, 1, (data + strlen(dataName)) - start, f);
+    fprintf(f, ",\n"
+               "\n"
+               "%s//\n"
+               "%s// A pointer to the advance width of each character.\n"
+               "%s//\n"
+               "%s%s,\n"
+               "\n"
+               "%s//\n"
+               "%s// Whether every character is the maximum width.\n"
+               "%s//\n"
+               "%s%s\n",
+            indent, indent, indent, indent, widthsName,
+            indent, indent, indent, indent, fixed ? "true" : "false");
+    fputs(close, f);
+    fclose(f);
+
+    printf("%s: %s%s\n", gen->file, widthsName, fixed ? ", fixed width" : "");
+    return 0;
+}
+
+int main(int argc, char *argv[])
+{
+    size_t i;
+
+    if (argc != 2)
+    {
+        fprintf(stderr, "usage: font_metrics fonts-directory\n");
+        return 1;
+    }
+
+    for (i = 0; i < sizeof(g_fonts) / sizeof(g_fonts[0]); i++)
+    {
+        if (Gen_font(argv[1], &g_fonts[i]) < 0)
+        {
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+#endif // __MSP430__
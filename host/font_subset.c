@@ -0,0 +1,300 @@
+// font_subset.c
+// Build-time subsetting of the trainer's font to the characters it draws.
+// The string literals of the sources are collected, with the characters a
+// conversion such as %d can print standing in for it, and a Graphics_FontEx
+// written over the range they span.  The glyphs drawn are kept, together
+// and in order; every other character in the range shares the glyph of '.',
+// which grlib draws for characters outside a font.  The bytes saved over
+// the full font are reported.
+//
+// Usage: font_subset ../static_fonts ../music_trainer.c ...    (make fonts)
+// writes ../static_fonts.c and ../static_fonts.h.  Both host builds rerun it
+// before compiling the font or trainer_hw.c whenever music_trainer.c changed.
+
+#ifndef __MSP430__
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "Grlib/grlib/grlib.h"
+#include "gen_util.h"
+
+// The font trainer_hw.c sets up, and the subset it uses instead.
+#define GEN_FONT            g_sFontFixed6x8
+#define GEN_FONT_NAME       "g_sFontFixed6x8"
+#define GEN_SUBSET_NAME     "FontFixed6x8Subset"
+
+// What grlib draws for characters outside a font, as in string.c.
+#define GEN_ABSENT          '.'
+
+#define GEN_SOURCE_BYTES    65536
+#define GEN_CHARS           95      // 32 to 126, as Graphics_Font holds
+
+//*****************************************************************************
+//
+// The characters each printf conversion the sources use can print.  %s
+// prints strings, whose literals are collected anyway; a conversion not
+// listed here cannot be subset.
+//
+//*****************************************************************************
+typedef struct Gen_Conversion
+{
+    char conversion;
+    const char *chars;
+} Gen_Conversion;
+
+static const Gen_Conversion g_conversions[] =
+{
+    { 'd', "-0123456789" },
+    { 'i', "-0123456789" },
+    { 'u', "0123456789" },
+    { 'x', "0123456789abcdef" },
+    { 'X', "0123456789ABCDEF" },
+    { 's', "" },
+    { '%', "%" },
+};
+
+static char g_source[GEN_SOURCE_BYTES];
+static uint8_t g_used[GEN_CHARS];
+
+//*****************************************************************************
+//
+// Marks the characters of a string literal as used, the characters a
+// conversion can print in its place.
+//
+//*****************************************************************************
+static int Gen_add(const char *p, size_t length, const char *path)
+{
+    const char *end = p + length;
+    const char *chars;
+    size_t i;
+
+    while (p < end)
+    {
+        chars = 0;
+        if ((*p == '\\') && (p + 1 < end))
+        {
+            //
+            // Escapes draw as control characters, which are not in the font.
+            //
+            p += 2;
+            continue;
+        }
+        if ((*p == '%') && (p + 1 < end))
+        {
+            //
+            // Skip the flags, width and precision to the conversion.
+            //
+            for (p++; (p < end) && strchr("-+ #0123456789.*hlz", *p); p++)
+            {
+            }
+            for (i = 0; (p < end) &&
+                        (i < sizeof(g_conversions) / sizeof(g_conversions[0]));
+                 i++)
+            {
+                if (g_conversions[i].conversion == *p)
+                {
+                    chars = g_conversions[i].chars;
+                }
+            }
+            if (!chars)
+            {
+                fprintf(stderr, "font_subset: %s: cannot subset %%%.1s\n",
+                        path, (p < end) ? p : "");
+                return -1;
+            }
+            for (; *chars; chars++)
+            {
+                g_used[*chars - 32] = 1;
+            }
+            p++;
+            continue;
+        }
+        if ((*p >= 32) && (*p <= 126))
+        {
+            g_used[*p - 32] = 1;
+        }
+        p++;
+    }
+
+    return 0;
+}
+
+int main(int argc, char *argv[])
+{
+    static uint8_t data[65536];
+    const Graphics_Font *font = &GEN_FONT;
+    uint16_t offsets[GEN_CHARS];
+    uint8_t widths[GEN_CHARS];
+    long fullBytes = 0, subsetBytes = 0, dataBytes = 0;
+    int first, last, absent, count, used = 0, c, i;
+    const uint8_t *glyph;
+    char path[256];
+    size_t bytes;
+    FILE *f;
+
+    if (argc < 3)
+    {
+        fprintf(stderr, "usage: font_subset output source.c ...\n");
+        return 1;
+    }
+
+    for (i = 2; i < argc; i++)
+    {
+        f = fopen(argv[i], "r");
+        if (!f)
+        {
+            fprintf(stderr, "font_subset: cannot read %s\n", argv[i]);
+            return 1;
+        }
+        bytes = fread(g_source, 1, sizeof(g_source) - 1, f);
+        fclose(f);
+        g_source[bytes] = 0;
+
+        if (Gen_scan(g_source, argv[i], Gen_add) < 0)
+        {
+            return 1;
+        }
+    }
+
+    //
+    // The range runs from the first character used to the last.  Spaces
+    // are drawn as glyphs too, so they count.
+    //
+    for (first = 0; (first < GEN_CHARS) && !g_used[first]; first++)
+    {
+    }
+    for (last = GEN_CHARS - 1; (last >= 0) && !g_used[last]; last--)
+    {
+    }
+    if (first > last)
+    {
+        fprintf(stderr, "font_subset: no strings\n");
+        return 1;
+    }
+    count = last - first + 1;
+
+    //
+    // The characters left out draw as '.' if the range has it, or as its
+    // first character, as Graphics_drawString() draws those outside it.
+    //
+    absent = GEN_ABSENT - 32;
+    if ((absent < first) || (absent > last))
+    {
+        absent = first;
+    }
+    g_used[absent] = 1;
+
+    //
+    // Copy the glyphs used, in order, and point the rest at the absent one.
+    //
+    for (c = 0; c < GEN_CHARS; c++)
+    {
+        glyph = font->data + font->offset[c];
+        fullBytes += glyph[0];
+        if ((c < first) || (c > last) || !g_used[c])
+        {
+            continue;
+        }
+        offsets[c] = dataBytes;
+        memcpy(data + dataBytes, glyph, glyph[0]);
+        dataBytes += glyph[0];
+        used++;
+    }
+    for (c = first; c <= last; c++)
+    {
+        if (!g_used[c])
+        {
+            offsets[c] = offsets[absent];
+        }
+        widths[c] = data[offsets[c] + 1];
+    }
+
+    //
+    // The glyphs and the offset and width tables; the rest of the two font
+    // structures is the same size.
+    //
+    fullBytes += (2 * GEN_CHARS) + (font->widths ? GEN_CHARS : 0);
+    subsetBytes = dataBytes + (2 * count) + count;
+
+    snprintf(path, sizeof(path), "%s.c", argv[1]);
+    f = fopen(path, "w");
+    if (!f)
+    {
+        fprintf(stderr, "font_subset: cannot write %s\n", path);
+        return 1;
+    }
+
+    fprintf(f, "// static_fonts.c\n"
+               "// " GEN_FONT_NAME " cut down to the characters of the "
+               "trainer's strings.\n"
+               "// Generated by host/font_subset.c (make -C host fonts); "
+               "do not edit.\n\n"
+               "#include \"static_fonts.h\"\n\n"
+               "// %d of the %d characters '%c' to '%c'; the rest draw as "
+               "'%c'\n"
+               "static const uint8_t g_puc" GEN_SUBSET_NAME "Data[%ld] =\n"
+               "{", used, count, first + 32, last + 32, absent + 32,
+            dataBytes);
+    Gen_writeBytes(f, data, dataBytes);
+    fprintf(f, "\n};\n\n"
+               "static const uint16_t g_pus" GEN_SUBSET_NAME "Offset[%d] =\n"
+               "{", count);
+    for (c = first; c <= last; c++)
+    {
+        fprintf(f, "%s%5u,", ((c - first) % 8) ? " " : "\n    ", offsets[c]);
+    }
+    fprintf(f, "\n};\n\n"
+               "static const uint8_t g_puc" GEN_SUBSET_NAME "Widths[%d] =\n"
+               "{", count);
+    Gen_writeBytes(f, widths + first, count);
+    fprintf(f, "\n};\n\n"
+               "const Graphics_FontEx g_s" GEN_SUBSET_NAME " =\n"
+               "{\n"
+               "    %s,\n"
+               "    %3d,    // maxWidth\n"
+               "    %3d,    // height\n"
+               "    %3d,    // baseline\n"
+               "    %3d,    // first\n"
+               "    %3d,    // last\n"
+               "    g_pus" GEN_SUBSET_NAME "Offset,\n"
+               "    g_puc" GEN_SUBSET_NAME "Data,\n"
+               "    g_puc" GEN_SUBSET_NAME "Widths,\n"
+               "    %s\n"
+               "};\n",
+            (font->format == GRAPHICS_FONT_FMT_PIXEL_RLE) ?
+                "GRAPHICS_FONT_FMT_EX_PIXEL_RLE" :
+                "GRAPHICS_FONT_FMT_EX_UNCOMPRESSED",
+            font->maxWidth, font->height, font->baseline, first + 32,
+            last + 32, font->fixedWidth ? "true" : "false");
+    fclose(f);
+
+    snprintf(path, sizeof(path), "%s.h", argv[1]);
+    f = fopen(path, "w");
+    if (!f)
+    {
+        fprintf(stderr, "font_subset: cannot write %s\n", path);
+        return 1;
+    }
+    fprintf(f, "// static_fonts.h\n"
+               "// The trainer's font, holding only the characters its "
+               "strings draw.\n"
+               "// Generated by host/font_subset.c (make -C host fonts); "
+               "do not edit.\n\n"
+               "#ifndef STATIC_FONTS_H_\n"
+               "#define STATIC_FONTS_H_\n\n"
+               "#include \"GrLib/grlib/grlib.h\"\n\n"
+               "// " GEN_FONT_NAME ", characters '%c' to '%c'\n"
+               "extern const Graphics_FontEx g_s" GEN_SUBSET_NAME ";\n\n"
+               "#endif // STATIC_FONTS_H_\n", first + 32, last + 32);
+    fclose(f);
+
+    printf("%s: %d of %d glyphs, '%c' to '%c'\n", GEN_FONT_NAME, used,
+           GEN_CHARS, first + 32, last + 32);
+    printf("g_s" GEN_SUBSET_NAME ": %ld bytes, was %ld; %ld saved\n",
+           subsetBytes, fullBytes, fullBytes - subsetBytes);
+    return 0;
+}
+
+#endif // __MSP430__
@@ -0,0 +1,99 @@
+// gen_util.c
+// Helpers shared by the build-time generators.
+
+#ifndef __MSP430__
+
+#include <ctype.h>
+#include <string.h>
+
+#include "gen_util.h"
+
+//*****************************************************************************
+//
+// Collects the string literals of a source, outside comments, character
+// constants and preprocessor lines, passing each to add.  path names the
+// source in add's messages.  Returns -1 if add fails.
+//
+//*****************************************************************************
+int Gen_scan(const char *p, const char *path, Gen_Literal add)
+{
+    const char *start;
+    int lineStart = 1;
+
+    while (*p)
+    {
+        if ((p[0] == '/') && (p[1] == '/'))
+        {
+            p = strchr(p, '\n');
+            if (!p)
+            {
+                break;
+            }
+        }
+        else if ((p[0] == '/') && (p[1] == '*'))
+        {
+            p = strstr(p + 2, "*/");
+            if (!p)
+            {
+                break;
+            }
+            p += 2;
+            continue;
+        }
+        else if (lineStart && (*p == '#'))
+        {
+            p = strchr(p, '\n');
+            if (!p)
+            {
+                break;
+            }
+        }
+        else if ((*p == '"') || (*p == '\''))
+        {
+            start = ++p;
+            while (*p && (*p != start[-1]))
+            {
+                p += ((p[0] == '\\') && p[1]) ? 2 : 1;
+            }
+            if ((start[-1] == '"') && (add(start, p - start, path) < 0))
+            {
+                return -1;
+            }
+            if (*p)
+            {
+                p++;
+            }
+            lineStart = 0;
+            continue;
+        }
+
+        if (*p == '\n')
+        {
+            lineStart = 1;
+        }
+        else if (!isspace((unsigned char)*p))
+        {
+            lineStart = 0;
+        }
+        p++;
+    }
+
+    return 0;
+}
+
+//*****************************************************************************
+//
+// Writes a byte table, GEN_PER_LINE to a line.
+//
+//*****************************************************************************
+void Gen_writeBytes(FILE *f, const uint8_t *bytes, int count)
+{
+    int i;
+
+    for (i = 0; i < count; i++)
+    {
+        fprintf(f, "%s%3d,", (i % GEN_PER_LINE) ? " " : "\n    ", bytes[i]);
+    }
+}
+
+#endif // __MSP430__
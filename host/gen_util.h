@@ -0,0 +1,28 @@
+// gen_util.h
+// Helpers shared by the build-time generators: collecting the string
+// literals of a source, and writing byte tables.
+
+#ifndef GEN_UTIL_H_
+#define GEN_UTIL_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+// Byte table entries written to a line.
+#define GEN_PER_LINE        12
+
+//*****************************************************************************
+//
+// Called by Gen_scan() with each string literal, as written between the
+// quotes, escapes included.  A negative return stops the scan.
+//
+//*****************************************************************************
+typedef int (*Gen_Literal)(const char *string, size_t length,
+                           const char *path);
+
+extern int Gen_scan(const char *source, const char *path, Gen_Literal add);
+
+extern void Gen_writeBytes(FILE *f, const uint8_t *bytes, int count);
+
+#endif // GEN_UTIL_H_
@@ -0,0 +1,908 @@
+// lcd_bench.c
+// Host benchmark for the LCD stack.  Plays through the music trainer with a
+// scripted joystick, reporting the SPI traffic of every screen, then measures
+// individual grlib primitives on the same context.
+//
+// Usage: lcd_bench [-g golden | -G golden] [-r reference-dir] [output-dir]
+// A snapshot of the panel is taken after every screen and every primitive.
+// With an output directory each is written there as a PPM.  -g checks the
+// CRC-32 of each snapshot against a golden file, exiting with 1 on any
+// difference; -G writes the golden file instead (make golden).  -r compares
+// every pixel with the PPMs another build wrote: the 12-bit build checks
+// that each pixel is the RGB444 truncation of the 16-bit build's RGB565 one.
+// make check runs every build this way.  A run also fails if the driver
+// overran the SPI transmit buffer or changed DC' with a byte on the wire.
+
+#ifndef __MSP430__
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "Grlib/grlib/grlib.h"
+#include "LcdDriver/lcd_band.h"
+#include "LcdDriver/lcd_driver.h"
+#include "LcdDriver/lcd_list.h"
+#include "LcdDriver/lcd_screen.h"
+#include "LcdDriver/lcd_scroll.h"
+#include "LcdDriver/lcd_tiles.h"
+#include "LcdDriver/lower_driver.h"
+#include "music_trainer.h"
+#include "msp430fr6989.h"
+#include "st7735_model.h"
+
+extern Graphics_Context g_sContext;
+extern const Graphics_Image UCF_Logo;
+
+#define BENCH_ADC_LOW       0
+#define BENCH_ADC_CENTER    2048
+#define BENCH_ADC_HIGH      4095
+
+// MCLK cycles per millisecond for the report.
+#define BENCH_CYCLES_PER_MS 16000
+
+//*****************************************************************************
+//
+// Joystick script.  Five LEFT presses take the question count from 10 down to
+// 5, UP starts the quiz, then the answers alternate between UP and DOWN.
+//
+//*****************************************************************************
+static const JoystickDir g_startScript[] = {
+    DIR_CENTER, DIR_LEFT, DIR_CENTER, DIR_LEFT, DIR_CENTER, DIR_LEFT,
+    DIR_CENTER, DIR_LEFT, DIR_CENTER, DIR_LEFT, DIR_CENTER, DIR_UP,
+    DIR_CENTER
+};
+static const JoystickDir g_answerScript[] = {
+    DIR_UP, DIR_CENTER, DIR_DOWN, DIR_CENTER
+};
+
+#define BENCH_COUNT(a)  (sizeof(a) / sizeof((a)[0]))
+
+// Snapshots a golden file can hold.
+#define BENCH_SNAPSHOTS     256
+
+// The bits of each 8-bit component the panel holds.  The model widens its
+// levels by repeating their top bits, so an RGB565 pixel cut to RGB444 and a
+// pixel sent as RGB444 agree in the top four bits of each component.
+#ifdef LCD_COLOR_12BIT
+#define BENCH_PIXEL_MASK    0xF0F0F0
+#else
+#define BENCH_PIXEL_MASK    0xFFFFFF
+#endif
+
+static uint32_t g_scriptStep;
+
+// While set, the joystick reads g_heldDir instead of the script.
+static uint8_t g_holding;
+static JoystickDir g_heldDir;
+static const char *g_outDir;
+static uint32_t g_snapshot;
+static uint64_t g_markCycles;
+
+// The golden CRCs, read by -g, or the file -G writes them to.
+static uint32_t g_golden[BENCH_SNAPSHOTS];
+static uint32_t g_goldenCount;
+static uint8_t g_goldenCheck;
+static FILE *g_goldenOut;
+static const char *g_refDir;
+static uint32_t g_failures;
+
+static JoystickDir Bench_scriptDir(void)
+{
+    if (g_scriptStep < BENCH_COUNT(g_startScript)) {
+        return g_startScript[g_scriptStep];
+    }
+    return g_answerScript[(g_scriptStep - BENCH_COUNT(g_startScript)) %
+                          BENCH_COUNT(g_answerScript)];
+}
+
+//*****************************************************************************
+//
+// ADC hook.  Joystick_ReadAxes() reads X (MEM0) and then Y (MEM1), so the
+// script advances after every Y read.
+//
+//*****************************************************************************
+static uint16_t Bench_readAdc(uint8_t channel)
+{
+    JoystickDir dir = g_holding ? g_heldDir : Bench_scriptDir();
+    uint16_t value = BENCH_ADC_CENTER;
+
+    if (channel == 0) {
+        if (dir == DIR_LEFT) {
+            value = BENCH_ADC_LOW;
+        } else if (dir == DIR_RIGHT) {
+            value = BENCH_ADC_HIGH;
+        }
+    } else {
+        if (dir == DIR_DOWN) {
+            value = BENCH_ADC_LOW;
+        } else if (dir == DIR_UP) {
+            value = BENCH_ADC_HIGH;
+        }
+        if (!g_holding) {
+            g_scriptStep++;
+        }
+    }
+
+    return value;
+}
+
+//*****************************************************************************
+//
+// CRC-32 of the panel as shown, each pixel as 24-bit RGB, top row first.
+//
+//*****************************************************************************
+static uint32_t Bench_panelCrc(void)
+{
+    uint32_t crc = 0xFFFFFFFF;
+    uint32_t rgb;
+    uint16_t x, y;
+    uint8_t i, bit;
+
+    for (y = 0; y < ST7735_MODEL_PANEL_SIZE; y++) {
+        for (x = 0; x < ST7735_MODEL_PANEL_SIZE; x++) {
+            rgb = ST7735Model_getPixel(x, y);
+            for (i = 0; i < 3; i++) {
+                crc ^= (rgb >> (16 - (8 * i))) & 0xFF;
+                for (bit = 0; bit < 8; bit++) {
+                    crc = (crc >> 1) ^ ((crc & 1) ? 0xEDB88320 : 0);
+                }
+            }
+        }
+    }
+
+    return ~crc;
+}
+
+//*****************************************************************************
+//
+// Checks the snapshot just taken against the golden file, or adds it there.
+//
+//*****************************************************************************
+static void Bench_golden(const char *name)
+{
+    uint32_t crc = Bench_panelCrc();
+
+    if (g_goldenOut) {
+        fprintf(g_goldenOut, "%03lu %08lx %s\n", (unsigned long)g_snapshot,
+                (unsigned long)crc, name);
+    }
+    if (g_goldenCheck) {
+        if (g_snapshot >= g_goldenCount) {
+            fprintf(stderr, "lcd_bench: snapshot %03lu (%s) is not in the "
+                            "golden file\n", (unsigned long)g_snapshot, name);
+            g_failures++;
+        } else if (crc != g_golden[g_snapshot]) {
+            fprintf(stderr, "lcd_bench: snapshot %03lu (%s) is %08lx, "
+                            "golden %08lx\n", (unsigned long)g_snapshot, name,
+                    (unsigned long)crc, (unsigned long)g_golden[g_snapshot]);
+            g_failures++;
+        }
+    }
+}
+
+//*****************************************************************************
+//
+// Compares the snapshot just taken with the same snapshot of another build,
+// pixel by pixel, under BENCH_PIXEL_MASK.
+//
+//*****************************************************************************
+static void Bench_reference(const char *name)
+{
+    static uint8_t ppm[ST7735_MODEL_PANEL_SIZE * ST7735_MODEL_PANEL_SIZE * 3];
+    uint32_t rgb, ref, differ = 0;
+    uint16_t x, y, width, height;
+    const uint8_t *p = ppm;
+    char path[256];
+    FILE *f;
+
+    snprintf(path, sizeof(path), "%s/%03lu.ppm", g_refDir,
+             (unsigned long)g_snapshot);
+    f = fopen(path, "rb");
+    if (!f || (fscanf(f, "P6 %hu %hu 255", &width, &height) != 2) ||
+        (fgetc(f) == EOF) || (width != ST7735_MODEL_PANEL_SIZE) ||
+        (height != ST7735_MODEL_PANEL_SIZE) ||
+        (fread(ppm, 1, sizeof(ppm), f) != sizeof(ppm))) {
+        fprintf(stderr, "lcd_bench: snapshot %03lu (%s): cannot read %s\n",
+                (unsigned long)g_snapshot, name, path);
+        g_failures++;
+        if (f) {
+            fclose(f);
+        }
+        return;
+    }
+    fclose(f);
+
+    for (y = 0; y < ST7735_MODEL_PANEL_SIZE; y++) {
+        for (x = 0; x < ST7735_MODEL_PANEL_SIZE; x++, p += 3) {
+            rgb = ST7735Model_getPixel(x, y);
+            ref = ((uint32_t)p[0] << 16) | ((uint32_t)p[1] << 8) | p[2];
+            if ((rgb ^ ref) & BENCH_PIXEL_MASK) {
+                if (!differ) {
+                    fprintf(stderr, "lcd_bench: snapshot %03lu (%s): pixel "
+                                    "(%u, %u) is %06lx, %s has %06lx\n",
+                            (unsigned long)g_snapshot, name, x, y,
+                            (unsigned long)rgb, path, (unsigned long)ref);
+                }
+                differ++;
+            }
+        }
+    }
+    if (differ) {
+        fprintf(stderr, "lcd_bench: snapshot %03lu (%s): %lu pixels "
+                        "differ\n", (unsigned long)g_snapshot, name,
+                (unsigned long)differ);
+        g_failures++;
+    }
+}
+
+//*****************************************************************************
+//
+// Reads a golden file written by -G.
+//
+//*****************************************************************************
+static int Bench_readGolden(const char *path)
+{
+    unsigned long index, crc;
+    char line[128];
+    FILE *f;
+
+    f = fopen(path, "r");
+    if (!f) {
+        fprintf(stderr, "lcd_bench: cannot read %s\n", path);
+        return -1;
+    }
+    while (fgets(line, sizeof(line), f)) {
+        if ((sscanf(line, "%lu %lx", &index, &crc) != 2) ||
+            (index != g_goldenCount) || (index >= BENCH_SNAPSHOTS)) {
+            fprintf(stderr, "lcd_bench: %s: bad line %lu\n", path,
+                    (unsigned long)g_goldenCount + 1);
+            fclose(f);
+            return -1;
+        }
+        g_golden[g_goldenCount++] = crc;
+    }
+    fclose(f);
+    g_goldenCheck = 1;
+    return 0;
+}
+
+//*****************************************************************************
+//
+// Prints one report line for the traffic since the last mark, saves a
+// snapshot and starts a new measurement.
+//
+//*****************************************************************************
+static void Bench_report(const char *name)
+{
+    const ST7735Model_Stats *stats = ST7735Model_getStats();
+    uint32_t addr;
+    uint64_t cycles;
+    char path[256];
+
+    // Pixels still held by the driver, queued for DMA or on the wire belong
+    // to this measurement.
+    Graphics_flushBuffer(&g_sContext);
+    HAL_LCD_txFlush();
+    addr = stats->commandData[CM_CASET] + stats->commandData[CM_RASET];
+    cycles = HostMsp430_cycles - g_markCycles;
+
+    printf("%-28s %8lu %7lu %7lu %8lu %7lu %8.2f\n", name,
+           (unsigned long)(stats->commandBytes + stats->dataBytes),
+           (unsigned long)stats->commandBytes,
+           (unsigned long)addr,
+           (unsigned long)stats->commandData[CM_RAMWR],
+           (unsigned long)stats->pixels,
+           (double)cycles / BENCH_CYCLES_PER_MS);
+
+    if (g_outDir) {
+        snprintf(path, sizeof(path), "%s/%03lu.ppm", g_outDir,
+                 (unsigned long)g_snapshot);
+        if (ST7735Model_dumpPPM(path) != 0) {
+            fprintf(stderr, "lcd_bench: cannot write %s\n", path);
+        }
+    }
+    Bench_golden(name);
+    if (g_refDir) {
+        Bench_reference(name);
+    }
+    g_snapshot++;
+
+    ST7735Model_clearStats();
+    g_markCycles = HostMsp430_cycles;
+}
+
+static void Bench_mark(void)
+{
+    HAL_LCD_txFlush();
+    ST7735Model_clearStats();
+    g_markCycles = HostMsp430_cycles;
+}
+
+//*****************************************************************************
+//
+// Idle hook.  Whenever the trainer stops to wait after drawing something, the
+// drawing is reported as one screen.
+//
+//*****************************************************************************
+static void Bench_idle(void)
+{
+    const ST7735Model_Stats *stats = ST7735Model_getStats();
+    char name[32];
+
+    if ((stats->commandBytes + stats->dataBytes) || HAL_LCD_dmaBusy() ||
+        (UCB0STATW & UCBUSY)) {
+        snprintf(name, sizeof(name), "screen %lu", (unsigned long)g_snapshot);
+        Bench_report(name);
+    } else {
+        g_markCycles = HostMsp430_cycles;
+    }
+}
+
+//*****************************************************************************
+//
+// Fails the run if the driver misused the SPI bus since the statistics were
+// last cleared.
+//
+//*****************************************************************************
+static void Bench_checkBus(void)
+{
+    const HostMsp430_SpiStats *spi = HostMsp430_getSpiStats();
+
+    if (spi->overruns || spi->dcGlitches) {
+        fprintf(stderr, "lcd_bench: %lu transmit buffer overruns, %lu DC' "
+                        "changes with a byte on the wire\n",
+                (unsigned long)spi->overruns,
+                (unsigned long)spi->dcGlitches);
+        g_failures++;
+    }
+}
+
+//*****************************************************************************
+//
+// Prints and resets the transport totals for a section.
+//
+//*****************************************************************************
+static void Bench_transport(void)
+{
+    const HostMsp430_SpiStats *spi = HostMsp430_getSpiStats();
+    const Lcd_TileStats *tiles = Crystalfontz128x128_GetTileStats();
+    const Lcd_WindowStats *win = Crystalfontz128x128_GetWindowStats();
+
+    printf("transport: cpu bytes %lu, dma bytes %lu in %lu blocks\n",
+           (unsigned long)spi->cpuBytes, (unsigned long)spi->dmaBytes,
+           (unsigned long)spi->dmaBlocks);
+    Bench_checkBus();
+    printf("windows: %lu set, %lu CASET and %lu RASET skipped; "
+           "pixel draws %lu, %lu coalesced\n",
+           (unsigned long)win->windows, (unsigned long)win->casetSkipped,
+           (unsigned long)win->rasetSkipped, (unsigned long)win->pixelDraws,
+           (unsigned long)win->coalesced);
+    if (tiles->clears) {
+        printf("tiles: %u clears (%u full), %lu tiles touched, "
+               "%lu repainted in %u windows\n",
+               tiles->clears, tiles->fullClears,
+               (unsigned long)tiles->touched, (unsigned long)tiles->flushed,
+               tiles->windows);
+    }
+    HostMsp430_clearSpiStats();
+    Crystalfontz128x128_ClearTileStats();
+    Crystalfontz128x128_ClearWindowStats();
+}
+
+static void Bench_header(const char *title)
+{
+    printf("\n%-28s %8s %7s %7s %8s %7s %8s\n", title,
+           "bytes", "cmd", "addr", "ramwr", "pixels", "ms");
+}
+
+// Rows per entry of the scrolled list.
+#define BENCH_LIST_PITCH    10
+
+//*****************************************************************************
+//
+// Scroll redraw callback: a list with one entry every BENCH_LIST_PITCH
+// content lines.
+//
+//*****************************************************************************
+static void Bench_drawList(Graphics_Context *context, int16_t lY,
+                           int16_t lLine, int16_t lCount)
+{
+    char text[24];
+    int16_t item;
+
+    for (item = lLine / BENCH_LIST_PITCH;
+         item * BENCH_LIST_PITCH < lLine + lCount; item++) {
+        snprintf(text, sizeof(text), "List entry %d", item);
+        Graphics_drawString(context, (int8_t *)text, AUTO_STRING_LENGTH, 4,
+                            lY + item * BENCH_LIST_PITCH - lLine + 1,
+                            TRANSPARENT_TEXT);
+    }
+}
+
+//*****************************************************************************
+//
+// Individual grlib primitives, each measured from a cleared screen.
+//
+//*****************************************************************************
+static void Bench_primitives(void)
+{
+    Graphics_Rectangle rect = { 10, 10, 117, 117 };
+    Graphics_Rectangle fill = { 48, 48, 79, 79 };
+
+    Bench_header("primitive");
+    HostMsp430_setIdleHook(0);
+
+    // The trainer draws through the framebuffer; measure the direct driver.
+    Graphics_initContext(&g_sContext, &g_sCrystalfontz128x128);
+
+    Graphics_setForegroundColor(&g_sContext, GRAPHICS_COLOR_WHITE);
+    Graphics_setBackgroundColor(&g_sContext, GRAPHICS_COLOR_BLACK);
+    GrContextFontSet(&g_sContext, &g_sFontFixed6x8);
+
+    Bench_mark();
+    Graphics_clearDisplay(&g_sContext);
+    Bench_report("Graphics_clearDisplay");
+
+    Graphics_drawPixel(&g_sContext, 64, 64);
+    Bench_report("Graphics_drawPixel");
+
+    Graphics_drawLineH(&g_sContext, 0, 127, 20);
+    Bench_report("Graphics_drawLineH 128");
+
+    Graphics_drawLineV(&g_sContext, 20, 0, 127);
+    Bench_report("Graphics_drawLineV 128");
+
+    Graphics_drawLine(&g_sContext, 0, 0, 127, 100);
+    Bench_report("Graphics_drawLine diagonal");
+
+    Graphics_drawRectangle(&g_sContext, &rect);
+    Bench_report("Graphics_drawRectangle");
+
+    Graphics_fillRectangle(&g_sContext, &fill);
+    Bench_report("Graphics_fillRectangle 32x32");
+
+    Graphics_drawCircle(&g_sContext, 64, 64, 30);
+    Bench_report("Graphics_drawCircle r30");
+
+    Graphics_fillCircle(&g_sContext, 64, 64, 20);
+    Bench_report("Graphics_fillCircle r20");
+
+    Graphics_clearDisplay(&g_sContext);
+    Bench_mark();
+    Graphics_drawString(&g_sContext, (int8_t *)"Music Trainer",
+                        AUTO_STRING_LENGTH, 10, 10, TRANSPARENT_TEXT);
+    Bench_report("Graphics_drawString transp");
+
+    Graphics_drawString(&g_sContext, (int8_t *)"Music Trainer",
+                        AUTO_STRING_LENGTH, 10, 30, OPAQUE_TEXT);
+    Bench_report("Graphics_drawString opaque");
+
+    Graphics_drawStringCentered(&g_sContext, (int8_t *)"Score: 3",
+                                AUTO_STRING_LENGTH, 64, 60, TRANSPARENT_TEXT);
+    Bench_report("Graphics_drawStringCentered");
+
+    Graphics_drawImage(&g_sContext, &UCF_Logo, 0, 0);
+    Bench_report("Graphics_drawImage logo");
+
+    // A list below a fixed title, moved one entry at a time.
+    Graphics_clearDisplay(&g_sContext);
+    Graphics_drawString(&g_sContext, (int8_t *)"Scrolled list",
+                        AUTO_STRING_LENGTH, 4, 4, TRANSPARENT_TEXT);
+    Bench_mark();
+    Crystalfontz128x128_ScrollBegin(&g_sContext, 16, 0);
+    Bench_drawList(&g_sContext, 16, 0, LCD_VERTICAL_MAX - 16);
+    Bench_report("list drawn in full");
+
+    Crystalfontz128x128_ScrollBy(&g_sContext, BENCH_LIST_PITCH,
+                                 Bench_drawList);
+    Bench_report("list scrolled up one entry");
+
+    Crystalfontz128x128_ScrollBy(&g_sContext, -BENCH_LIST_PITCH,
+                                 Bench_drawList);
+    Bench_report("list scrolled back");
+    Crystalfontz128x128_ScrollEnd(&g_sContext);
+
+    Bench_transport();
+}
+
+// Virtual time between idle polls: 100 ms.
+#define BENCH_POLL_CYCLES   (100UL * BENCH_CYCLES_PER_MS)
+
+//*****************************************************************************
+//
+// Presses UP with the display in the given power state.  The press must be
+// passed on unless the panel was dark, when it only wakes the display.
+//
+//*****************************************************************************
+static void Bench_wakePress(uint8_t state, const char *name)
+{
+    uint8_t dark = (state == LCD_POWER_OFF) || (state == LCD_POWER_SLEEP);
+    JoystickDir dir;
+
+    g_holding = 1;
+    g_heldDir = DIR_CENTER;
+    Joystick_GetDir();
+    Crystalfontz128x128_PowerEnter(state);
+    g_heldDir = DIR_UP;
+    dir = Joystick_GetDir();
+    g_holding = 0;
+
+    if ((dir == DIR_UP) == dark) {
+        fprintf(stderr, "lcd_bench: a press waking the display from %s was "
+                        "%s\n", name, dark ? "passed on" : "dropped");
+        g_failures++;
+    }
+}
+
+//*****************************************************************************
+//
+// Leaves a static screen alone until the display power manager has gone
+// through all its states, reporting each transition, then wakes it.
+//
+//*****************************************************************************
+static void Bench_power(void)
+{
+    static const char *const names[LCD_POWER_STATES] = {
+        "active", "dim", "partial", "off", "sleep"
+    };
+    const Lcd_PowerStats *stats = Crystalfontz128x128_GetPowerStats();
+    uint32_t idleMs = 0;
+    uint8_t state;
+    char name[32];
+
+    Bench_header("power");
+
+    Graphics_clearDisplay(&g_sContext);
+    Graphics_drawStringCentered(&g_sContext, (int8_t *)"Game Over",
+                                AUTO_STRING_LENGTH, 64, 20, TRANSPARENT_TEXT);
+    Graphics_drawStringCentered(&g_sContext, (int8_t *)"Press RESET",
+                                AUTO_STRING_LENGTH, 64, 70, TRANSPARENT_TEXT);
+    Graphics_flushBuffer(&g_sContext);
+    Crystalfontz128x128_SetPartialArea(16, 87);
+    Crystalfontz128x128_ClearPowerStats();
+
+    while (Crystalfontz128x128_GetPowerState() != LCD_POWER_SLEEP) {
+        state = Crystalfontz128x128_GetPowerState();
+        HostMsp430_delayCycles(BENCH_POLL_CYCLES);
+        idleMs += 100;
+        Bench_mark();
+        Crystalfontz128x128_PowerPoll();
+        if (Crystalfontz128x128_GetPowerState() != state) {
+            snprintf(name, sizeof(name), "idle %lu ms: %s",
+                     (unsigned long)idleMs,
+                     names[Crystalfontz128x128_GetPowerState()]);
+            Bench_report(name);
+        }
+    }
+
+    Bench_mark();
+    Crystalfontz128x128_PowerWake();
+    Bench_report("wake from sleep");
+    printf("backlight after waking: %u%%\n", HAL_LCD_getBacklight());
+
+    Crystalfontz128x128_PowerEnter(LCD_POWER_DIM);
+    Bench_report("enter dim");
+    HostMsp430_delayCycles(10 * BENCH_POLL_CYCLES);
+    printf("backlight 1 s after dimming: %u%%\n", HAL_LCD_getBacklight());
+    Bench_mark();
+    Crystalfontz128x128_PowerWake();
+    Bench_report("wake from dim");
+    HostMsp430_delayCycles(BENCH_POLL_CYCLES);
+    printf("backlight 100 ms after waking: %u%%\n", HAL_LCD_getBacklight());
+    Bench_mark();
+
+    Crystalfontz128x128_PowerEnter(LCD_POWER_OFF);
+    Bench_report("enter off");
+    Crystalfontz128x128_PowerWake();
+    Bench_report("wake from off");
+
+    Crystalfontz128x128_PowerEnter(LCD_POWER_PARTIAL);
+    Bench_report("enter partial");
+    Crystalfontz128x128_PowerWake();
+    Bench_report("wake from partial");
+
+    for (state = LCD_POWER_DIM; state < LCD_POWER_STATES; state++) {
+        printf("%s: entered %u times, enter %lu us, exit %lu us\n",
+               names[state], stats->entries[state],
+               (unsigned long)stats->enterTime[state],
+               (unsigned long)stats->exitTime[state]);
+    }
+    for (state = LCD_POWER_DIM; state < LCD_POWER_STATES; state++) {
+        Bench_wakePress(state, names[state]);
+    }
+    Bench_transport();
+}
+
+// A whole screen at 4 BPP, and a 1 BPP strip.
+#define BENCH_OFFSCREEN_4BPP_BYTES  (6 + (16 * 3) + (64 * 128))
+#define BENCH_OFFSCREEN_1BPP_BYTES  (5 + (12 * 16))
+
+//*****************************************************************************
+//
+// Composes screens in offscreen images and sends each to the panel in one
+// address window.
+//
+//*****************************************************************************
+static void Bench_offscreen(void)
+{
+    static uint8_t image4[BENCH_OFFSCREEN_4BPP_BYTES];
+    static uint8_t image1[BENCH_OFFSCREEN_1BPP_BYTES];
+    Graphics_Display offscreen;
+    Graphics_Context context;
+    Graphics_Rectangle rect = { 8, 88, 119, 119 };
+
+    Bench_header("offscreen");
+    printf("4 BPP 128x128 image: %lu bytes\n",
+           (unsigned long)Graphics_getOffscreen4BppImageSize(128, 128));
+
+    // The logo's palette also holds the white and gold the text needs.
+    Graphics_initOffscreen4BppImage(&offscreen, image4, 128, 128);
+    Graphics_setOffscreen4BppPalette(&offscreen,
+                                     (uint32_t *)UCF_Logo.pPalette, 0, 16);
+    Graphics_initContext(&context, &offscreen);
+    Graphics_setBackgroundColor(&context, GRAPHICS_COLOR_BLACK);
+    Graphics_setForegroundColor(&context, GRAPHICS_COLOR_GOLD);
+    GrContextFontSet(&context, &g_sFontFixed6x8);
+
+    Bench_mark();
+    Graphics_drawImage(&context, &UCF_Logo, 0, 0);
+    Graphics_fillRectangle(&context, &rect);
+    Graphics_setForegroundColor(&context, GRAPHICS_COLOR_BLACK);
+    Graphics_drawStringCentered(&context, (int8_t *)"Music Trainer",
+                                AUTO_STRING_LENGTH, 64, 98, TRANSPARENT_TEXT);
+    Graphics_drawStringCentered(&context, (int8_t *)"Score: 3",
+                                AUTO_STRING_LENGTH, 64, 110, TRANSPARENT_TEXT);
+    Graphics_flushBuffer(&context);
+    Bench_report("4 BPP screen composed");
+
+    Crystalfontz128x128_ClearWindowStats();
+    Crystalfontz128x128_BlitOffscreen(&offscreen, 0, 0);
+    printf("4 BPP screen sent in %lu address window(s)\n",
+           (unsigned long)Crystalfontz128x128_GetWindowStats()->windows);
+    Bench_report("4 BPP screen sent");
+
+    // A label hanging off the left edge of the panel.
+    Graphics_initOffscreen1BppImage(&offscreen, image1, 96, 16);
+    Graphics_initContext(&context, &offscreen);
+    Graphics_setBackgroundColor(&context, GRAPHICS_COLOR_WHITE);
+    Graphics_setForegroundColor(&context, GRAPHICS_COLOR_BLACK);
+    GrContextFontSet(&context, &g_sFontFixed6x8);
+    Graphics_clearDisplay(&context);
+    Graphics_drawString(&context, (int8_t *)"    Next: C#4",
+                        AUTO_STRING_LENGTH, 2, 4, TRANSPARENT_TEXT);
+
+    Bench_mark();
+    Crystalfontz128x128_BlitOffscreen(&offscreen, -21, 4);
+    Bench_report("1 BPP label, clipped");
+
+    Bench_transport();
+}
+
+//*****************************************************************************
+//
+// The screen composed offscreen above, drawn again for the banded driver.
+//
+//*****************************************************************************
+static void Bench_drawBanded(Graphics_Context *context)
+{
+    Graphics_Rectangle rect = { 8, 88, 119, 119 };
+
+    Graphics_drawImage(context, &UCF_Logo, 0, 0);
+    Graphics_setForegroundColor(context, GRAPHICS_COLOR_GOLD);
+    Graphics_fillRectangle(context, &rect);
+    Graphics_setForegroundColor(context, GRAPHICS_COLOR_BLACK);
+    Graphics_drawStringCentered(context, (int8_t *)"Music Trainer",
+                                AUTO_STRING_LENGTH, 64, 98, TRANSPARENT_TEXT);
+    Graphics_drawStringCentered(context, (int8_t *)"Score: 3",
+                                AUTO_STRING_LENGTH, 64, 110, TRANSPARENT_TEXT);
+}
+
+//*****************************************************************************
+//
+// Renders a full screen through the banded driver, in one address window.
+//
+//*****************************************************************************
+static void Bench_band(void)
+{
+    const Lcd_BandStats *stats = Crystalfontz128x128_GetBandStats();
+    Graphics_Context context;
+
+    Bench_header("band");
+    printf("band buffers: %u bytes\n", Crystalfontz128x128_GetBandBytes());
+
+    Graphics_initContext(&context, &g_sCrystalfontz128x128_Banded);
+    Graphics_setBackgroundColor(&context, GRAPHICS_COLOR_BLACK);
+    GrContextFontSet(&context, &g_sFontFixed6x8);
+
+    Crystalfontz128x128_ClearBandStats();
+    Crystalfontz128x128_ClearWindowStats();
+    Bench_mark();
+    Crystalfontz128x128_BandRender(&context, Bench_drawBanded);
+    printf("%lu bands, %lu drawn while the previous was sent, "
+           "%lu address window(s)\n",
+           (unsigned long)stats->bands, (unsigned long)stats->overlapped,
+           (unsigned long)Crystalfontz128x128_GetWindowStats()->windows);
+    Bench_report("banded screen");
+
+    Bench_transport();
+}
+
+static uint8_t g_listBuffer[256];
+static Lcd_DisplayList g_list;
+
+// Replays g_list for the banded driver.
+static void Bench_replayList(Graphics_Context *context)
+{
+    Crystalfontz128x128_ListReplay(&g_list, context);
+}
+
+//*****************************************************************************
+//
+// Records the final trainer screen, with a score bar drawn a row at a time,
+// into a display list; optimizes it, measures the cost of each op and
+// replays it to the panel and to the banded driver.
+//
+//*****************************************************************************
+static void Bench_list(void)
+{
+    static const char *const names[] = {
+        "", "foreground", "background", "font", "clear", "pixel", "line",
+        "rectangle", "fill", "circle", "fill circle", "image", "string",
+        "string centered", "flush", "string width"
+    };
+    Graphics_Rectangle span = { 24, 0, 103, 0 };
+    Graphics_Context context;
+    Lcd_ListOp op;
+    uint16_t offset, saved;
+    char name[32];
+
+    Bench_header("display list");
+    Crystalfontz128x128_ListInit(&g_list, g_listBuffer, sizeof(g_listBuffer));
+
+    Crystalfontz128x128_ListSetBackground(&g_list, GRAPHICS_COLOR_BLACK);
+    Crystalfontz128x128_ListSetFont(&g_list, &g_sFontFixed6x8);
+    Crystalfontz128x128_ListClear(&g_list);
+    Crystalfontz128x128_ListSetForeground(&g_list, GRAPHICS_COLOR_WHITE);
+    Crystalfontz128x128_ListDrawStringCentered(&g_list,
+        (int8_t *)"Game Over", AUTO_STRING_LENGTH, 64, 20, TRANSPARENT_TEXT);
+    Crystalfontz128x128_ListDrawStringCentered(&g_list,
+        (int8_t *)"Score: 3 / 5", AUTO_STRING_LENGTH, 64, 40,
+        TRANSPARENT_TEXT);
+    for (span.yMin = 52; span.yMin < 58; span.yMin++) {
+        span.yMax = span.yMin;
+        Crystalfontz128x128_ListSetForeground(&g_list, GRAPHICS_COLOR_GREEN);
+        Crystalfontz128x128_ListFillRectangle(&g_list, &span);
+    }
+    Crystalfontz128x128_ListSetForeground(&g_list, GRAPHICS_COLOR_WHITE);
+    Crystalfontz128x128_ListSetForeground(&g_list, GRAPHICS_COLOR_CYAN);
+    Crystalfontz128x128_ListDrawStringCentered(&g_list,
+        (int8_t *)"Press RESET", AUTO_STRING_LENGTH, 64, 70,
+        TRANSPARENT_TEXT);
+    Crystalfontz128x128_ListDrawStringCentered(&g_list,
+        (int8_t *)"to play again", AUTO_STRING_LENGTH, 64, 82,
+        TRANSPARENT_TEXT);
+    Crystalfontz128x128_ListFlush(&g_list);
+
+    printf("recorded: %u bytes\n", g_list.length);
+    saved = Crystalfontz128x128_ListOptimize(&g_list);
+    printf("optimized: %u bytes (%u saved)\n", g_list.length, saved);
+
+    // The cost of each op on the direct driver.
+    Graphics_initContext(&context, &g_sCrystalfontz128x128);
+    Bench_mark();
+    for (offset = 0; offset < g_list.length; ) {
+        offset = Crystalfontz128x128_ListNext(&g_list, offset, &op);
+        Crystalfontz128x128_ListDraw(&context, &op);
+        if (op.code == LCD_LIST_FLUSH) {
+            Bench_report("list replayed");
+        } else {
+            snprintf(name, sizeof(name), "  %s", names[op.code]);
+            Bench_report(name);
+        }
+    }
+
+    Graphics_initContext(&context, &g_sCrystalfontz128x128_Banded);
+    Bench_mark();
+    Crystalfontz128x128_BandRender(&context, Bench_replayList);
+    Bench_report("list replayed in bands");
+
+    Bench_transport();
+}
+
+//*****************************************************************************
+//
+// How the trainer's retained screens were shown.
+//
+//*****************************************************************************
+static void Bench_screens(void)
+{
+    const Lcd_ScreenStats *stats = Crystalfontz128x128_GetScreenStats();
+
+    printf("retained screens: %u shown, %u redrawn whole; "
+           "ops %u kept, %u added, %u removed (%u overwritten); %u boxes\n",
+           stats->shown, stats->fullRedraws, stats->kept, stats->added,
+           stats->removed, stats->overwritten, stats->boxes);
+}
+
+//*****************************************************************************
+//
+// How often the trainer's text was drawn from the decoded glyph cache.
+//
+//*****************************************************************************
+static void Bench_glyphs(void)
+{
+    const Graphics_GlyphCacheStats *stats = Graphics_getGlyphCacheStats();
+
+    printf("glyph cache: %lu hits, %lu misses\n",
+           (unsigned long)stats->hits, (unsigned long)stats->misses);
+}
+
+int main(int argc, char *argv[])
+{
+    int i;
+
+    for (i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "-g") && (i + 1 < argc)) {
+            if (Bench_readGolden(argv[++i]) < 0) {
+                return 1;
+            }
+        } else if (!strcmp(argv[i], "-G") && (i + 1 < argc)) {
+            g_goldenOut = fopen(argv[++i], "w");
+            if (!g_goldenOut) {
+                fprintf(stderr, "lcd_bench: cannot write %s\n", argv[i]);
+                return 1;
+            }
+        } else if (!strcmp(argv[i], "-r") && (i + 1 < argc)) {
+            g_refDir = argv[++i];
+        } else if ((argv[i][0] != '-') && !g_outDir) {
+            g_outDir = argv[i];
+        } else {
+            fprintf(stderr, "usage: lcd_bench [-g golden | -G golden] "
+                            "[-r reference-dir] [output-dir]\n");
+            return 1;
+        }
+    }
+
+    HostMsp430_setAdcHook(Bench_readAdc);
+    HostMsp430_setIdleHook(Bench_idle);
+
+    // DMA completion and backlight fades run from interrupts, as in main().
+    __enable_interrupt();
+
+    Bench_header("trainer");
+    MusicTrainer_Init();
+    MusicTrainer_Run();
+    Bench_idle();
+    printf("time to first frame: %lu us\n",
+           (unsigned long)Crystalfontz128x128_GetBootTime());
+    Bench_screens();
+    Bench_glyphs();
+    Bench_transport();
+
+    Bench_primitives();
+    Bench_power();
+    Bench_offscreen();
+    Bench_band();
+    Bench_list();
+    Bench_checkBus();
+
+    if (g_goldenOut && (fclose(g_goldenOut) != 0)) {
+        fprintf(stderr, "lcd_bench: cannot write the golden file\n");
+        return 1;
+    }
+    if (g_goldenCheck && (g_snapshot != g_goldenCount)) {
+        fprintf(stderr, "lcd_bench: %lu snapshots, golden file has %lu\n",
+                (unsigned long)g_snapshot, (unsigned long)g_goldenCount);
+        g_failures++;
+    }
+    if (g_failures) {
+        fprintf(stderr, "lcd_bench: %lu check(s) failed\n",
+                (unsigned long)g_failures);
+        return 1;
+    }
+
+    return 0;
+}
+
+#endif // __MSP430__
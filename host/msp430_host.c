@@ -0,0 +1,513 @@
+// msp430_host.c
+// Register storage, scripted ADC and virtual clock behind host/msp430fr6989.h,
+// and models of the peripherals the LCD transport drives: eUSCI_B0 in SPI
+// master mode feeding the ST7735 model, DMA channel 0 and the CCR0 interrupt
+// of Timer_B0.
+//
+// The models run on their own clock, which follows the CPU's: each access
+// to a modelled register first applies what the CPU wrote to the registers
+// since the previous one, then runs the models up to the virtual clock.
+// Interrupt handlers are called at the cycle their flag is raised, and the
+// cycles they take are added to the code they interrupted.
+
+#ifndef __MSP430__
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "msp430fr6989.h"
+#include "st7735_model.h"
+
+#define HOST_MSP430_DEFINE(name) volatile uint16_t name;
+HOST_MSP430_REGISTERS(HOST_MSP430_DEFINE)
+#undef HOST_MSP430_DEFINE
+
+// Cycles of a 16 MHz MCLK elapsed since start-up.
+uint64_t HostMsp430_cycles;
+
+// Estimated cost of one instruction accessing a peripheral register, with
+// the FRAM wait state.
+#define HOST_ACCESS_CYCLES      4
+
+// Interrupt entry and RETI.
+#define HOST_ISR_ENTRY_CYCLES   6
+#define HOST_ISR_EXIT_CYCLES    5
+
+// SMCLK (16 MHz) / 2 gives an 8 MHz SPI clock: 8 bits take 16 MCLK cycles.
+#define HOST_SPI_CYCLES_PER_BYTE 16
+
+// Written to UCB0TXBUF at every access, so that a write can be told apart.
+// No 16-bit value matches it.
+#define HOST_TXBUF_UNWRITTEN    0xFFFFFFFFu
+
+// The firmware's interrupt handlers, by vector.
+extern void HAL_LCD_dmaIsr(void);           // DMA_VECTOR
+extern void HAL_LCD_backlightIsr(void);     // TIMER0_B0_VECTOR
+
+//*****************************************************************************
+//
+// Modelled registers as the CPU sees them, and their values as the models
+// last saw them.  A difference is a write by the CPU.  The registers are 16
+// bits wide, held in 32 so that UCB0TXBUF can hold HOST_TXBUF_UNWRITTEN.
+// The eUSCI comes out of reset with UCTXIFG set.
+//
+//*****************************************************************************
+static volatile uint32_t g_registers[HOST_MSP430_MODELLED_COUNT] =
+{
+    [HOST_MSP430_UCB0TXBUF] = HOST_TXBUF_UNWRITTEN,
+    [HOST_MSP430_UCB0IFG] = UCTXIFG,
+};
+static uint32_t g_seen[HOST_MSP430_MODELLED_COUNT] =
+{
+    [HOST_MSP430_UCB0TXBUF] = HOST_TXBUF_UNWRITTEN,
+    [HOST_MSP430_UCB0IFG] = UCTXIFG,
+};
+
+// The cycle the models have been run up to; never ahead of the CPU.
+static uint64_t g_modelCycles;
+
+static uint16_t g_sr;
+
+//*****************************************************************************
+//
+// eUSCI_B0: the transmit buffer and the shift register behind it.
+//
+//*****************************************************************************
+static struct
+{
+    uint8_t txbufFull;
+    uint8_t txbuf;
+    uint8_t shifting;
+    uint8_t shift;
+    uint64_t shiftEnd;
+} g_spi;
+
+static HostMsp430_SpiStats g_spiStats;
+
+//*****************************************************************************
+//
+// DMA channel 0.  Address and size are latched when DMAEN is set.
+//
+//*****************************************************************************
+static struct
+{
+    unsigned long sourceReg;
+    unsigned long destReg;
+    unsigned long source;
+    unsigned long dest;
+    uint16_t remaining;
+} g_dma;
+
+// Timer_B0 in up mode: the cycle at which the count next reaches TB0CCR0.
+static uint64_t g_timerNext;
+
+// delay_ms() spins in chunks of 16000 cycles; anything that long means the
+// firmware is waiting on a human rather than drawing.
+#define HOST_IDLE_DELAY_CYCLES  16000
+
+// Mid-scale reading, i.e. a centred joystick.
+#define HOST_ADC_IDLE_VALUE     2048
+
+static uint16_t (*g_adcHook)(uint8_t channel);
+static void (*g_idleHook)(void);
+
+// Sets a modelled register on behalf of the hardware.
+static void HostMsp430_set(HostMsp430_Register reg, uint32_t value)
+{
+    g_registers[reg] = value;
+    g_seen[reg] = value;
+}
+
+static void HostMsp430_spiWrite(uint8_t data);
+static void HostMsp430_spiLoad(void);
+
+//*****************************************************************************
+//
+// DMA channel 0 has seen its trigger: it moves one byte.  Only the
+// UCB0TXIFG trigger and byte transfers to a fixed destination are modelled.
+//
+//*****************************************************************************
+static void HostMsp430_dmaTrigger(void)
+{
+    uint16_t ctl = g_registers[HOST_MSP430_DMA0CTL];
+    uint8_t data;
+
+    if (!(ctl & DMAEN) || ((g_registers[HOST_MSP430_DMACTL0] & DMA0TSEL_31) !=
+                           DMA0TSEL__UCB0TXIFG0)) {
+        return;
+    }
+
+    data = *(const uint8_t *)g_dma.source;
+    if ((ctl & DMASRCINCR_3) == DMASRCINCR_3) {
+        g_dma.source++;
+    }
+    if (--g_dma.remaining == 0) {
+        HostMsp430_set(HOST_MSP430_DMA0CTL, (ctl & ~DMAEN) | DMAIFG);
+    }
+
+    if (g_dma.dest == (unsigned long)&g_registers[HOST_MSP430_UCB0TXBUF]) {
+        g_spiStats.dmaBytes++;
+        HostMsp430_spiWrite(data);
+    } else {
+        *(uint8_t *)g_dma.dest = data;
+    }
+}
+
+//*****************************************************************************
+//
+// A byte is written to UCB0TXBUF.  UCTXIFG drops until the shift register
+// takes it, at once if the shift register is idle.
+//
+//*****************************************************************************
+static void HostMsp430_spiWrite(uint8_t data)
+{
+    if (g_spi.txbufFull) {
+        g_spiStats.overruns++;
+    }
+    g_spi.txbuf = data;
+    g_spi.txbufFull = 1;
+    HostMsp430_set(HOST_MSP430_UCB0IFG,
+                   g_registers[HOST_MSP430_UCB0IFG] & ~UCTXIFG);
+
+    if (!g_spi.shifting) {
+        HostMsp430_spiLoad();
+    }
+}
+
+// Moves the transmit buffer into the shift register, raising UCTXIFG.
+static void HostMsp430_spiLoad(void)
+{
+    g_spi.shift = g_spi.txbuf;
+    g_spi.txbufFull = 0;
+    g_spi.shifting = 1;
+    g_spi.shiftEnd = g_modelCycles + HOST_SPI_CYCLES_PER_BYTE;
+
+    HostMsp430_set(HOST_MSP430_UCB0IFG,
+                   g_registers[HOST_MSP430_UCB0IFG] | UCTXIFG);
+    HostMsp430_dmaTrigger();
+}
+
+// The last bit of a byte is out; the panel samples DC' with it.
+static void HostMsp430_spiDone(void)
+{
+    if (g_registers[HOST_MSP430_P2OUT] & BIT3) {
+        ST7735Model_writeData(g_spi.shift);
+    } else {
+        ST7735Model_writeCommand(g_spi.shift);
+    }
+    g_spi.shifting = 0;
+
+    if (g_spi.txbufFull) {
+        HostMsp430_spiLoad();
+    }
+}
+
+//*****************************************************************************
+//
+// Applies what the CPU wrote to the modelled registers since the models
+// last looked.
+//
+//*****************************************************************************
+static void HostMsp430_applyWrites(void)
+{
+    uint32_t value, old;
+    int reg;
+
+    for (reg = 0; reg < HOST_MSP430_MODELLED_COUNT; reg++) {
+        value = g_registers[reg];
+        old = g_seen[reg];
+        if (value == old) {
+            continue;
+        }
+        if (reg != HOST_MSP430_UCB0TXBUF) {
+            value &= 0xFFFF;
+            g_registers[reg] = value;
+        }
+        g_seen[reg] = value;
+
+        switch (reg) {
+            case HOST_MSP430_P2OUT:
+                if (((value ^ old) & BIT3) && g_spi.shifting) {
+                    g_spiStats.dcGlitches++;
+                }
+                break;
+
+            case HOST_MSP430_P9OUT:
+                // The controller restarts when RESET is released.
+                if (value & ~old & BIT4) {
+                    ST7735Model_reset();
+                }
+                break;
+
+            case HOST_MSP430_UCB0TXBUF:
+                HostMsp430_set(HOST_MSP430_UCB0TXBUF, HOST_TXBUF_UNWRITTEN);
+                g_spiStats.cpuBytes++;
+                HostMsp430_spiWrite(value);
+                break;
+
+            case HOST_MSP430_UCB0IFG:
+                // Setting UCTXIFG from software is a trigger edge for the DMA.
+                if (value & ~old & UCTXIFG) {
+                    HostMsp430_dmaTrigger();
+                }
+                break;
+
+            case HOST_MSP430_DMA0CTL:
+                if (value & ~old & DMAEN) {
+                    g_dma.source = g_dma.sourceReg;
+                    g_dma.dest = g_dma.destReg;
+                    g_dma.remaining = g_registers[HOST_MSP430_DMA0SZ];
+                    g_spiStats.dmaBlocks++;
+                }
+                break;
+
+            case HOST_MSP430_TB0CTL:
+                if (value & TBCLR) {
+                    HostMsp430_set(HOST_MSP430_TB0CTL, value & ~TBCLR);
+                    g_timerNext = g_modelCycles +
+                                  (uint32_t)g_registers[HOST_MSP430_TB0CCR0] + 1;
+                }
+                break;
+
+            default:
+                break;
+        }
+    }
+}
+
+//*****************************************************************************
+//
+// Calls an interrupt handler at the current model cycle, with GIE cleared
+// as the hardware does.  The CPU time it takes is added to the interrupted
+// code.
+//
+//*****************************************************************************
+static void HostMsp430_interrupt(void (*isr)(void))
+{
+    uint64_t interrupted = HostMsp430_cycles;
+
+    g_sr &= ~GIE;
+    HostMsp430_cycles = g_modelCycles + HOST_ISR_ENTRY_CYCLES;
+    isr();
+    HostMsp430_applyWrites();
+    HostMsp430_cycles += HOST_ISR_EXIT_CYCLES;
+    g_sr |= GIE;
+
+    HostMsp430_cycles = interrupted + (HostMsp430_cycles - g_modelCycles);
+}
+
+// Calls the handler of every pending, enabled interrupt.
+static void HostMsp430_dispatch(void)
+{
+    uint16_t ctl;
+
+    if (!(g_sr & GIE)) {
+        return;
+    }
+
+    ctl = g_registers[HOST_MSP430_DMA0CTL];
+    if ((ctl & DMAIE) && (ctl & DMAIFG)) {
+        HostMsp430_interrupt(HAL_LCD_dmaIsr);
+    }
+
+    // CCR0 has a vector of its own, which clears CCIFG when taken.
+    ctl = g_registers[HOST_MSP430_TB0CCTL0];
+    if ((ctl & CCIE) && (ctl & CCIFG)) {
+        HostMsp430_set(HOST_MSP430_TB0CCTL0, ctl & ~CCIFG);
+        HostMsp430_interrupt(HAL_LCD_backlightIsr);
+    }
+}
+
+//*****************************************************************************
+//
+// Runs the models up to the virtual clock, event by event, calling the
+// interrupt handlers as their flags are raised.
+//
+//*****************************************************************************
+static void HostMsp430_run(void)
+{
+    enum { HOST_EVENT_NONE, HOST_EVENT_SPI, HOST_EVENT_TIMER } event;
+    uint64_t next;
+
+    HostMsp430_applyWrites();
+
+    for (;;) {
+        event = HOST_EVENT_NONE;
+        next = HostMsp430_cycles;
+        if (g_spi.shifting && (g_spi.shiftEnd <= next)) {
+            event = HOST_EVENT_SPI;
+            next = g_spi.shiftEnd;
+        }
+        if (((g_registers[HOST_MSP430_TB0CTL] & MC_3) == MC__UP) &&
+            (g_timerNext <= next)) {
+            event = HOST_EVENT_TIMER;
+            next = g_timerNext;
+        }
+        if (event == HOST_EVENT_NONE) {
+            break;
+        }
+
+        if (next > g_modelCycles) {
+            g_modelCycles = next;
+        }
+        if (event == HOST_EVENT_SPI) {
+            HostMsp430_spiDone();
+        } else {
+            g_timerNext += (uint32_t)g_registers[HOST_MSP430_TB0CCR0] + 1;
+            HostMsp430_set(HOST_MSP430_TB0CCTL0,
+                           g_registers[HOST_MSP430_TB0CCTL0] | CCIFG);
+        }
+        HostMsp430_dispatch();
+    }
+
+    g_modelCycles = HostMsp430_cycles;
+    HostMsp430_dispatch();
+}
+
+//*****************************************************************************
+//
+//! Returns a modelled register, with the models run up to the moment of the
+//! access.
+//!
+//! \param reg is the register.
+//!
+//! The access is charged HOST_ACCESS_CYCLES.  Status registers are brought
+//! up to date before they are returned.
+//!
+//! \return Returns a pointer to the register, which is held in 32 bits.
+//
+//*****************************************************************************
+volatile uint32_t *HostMsp430_access(HostMsp430_Register reg)
+{
+    HostMsp430_cycles += HOST_ACCESS_CYCLES;
+    HostMsp430_run();
+
+    if (reg == HOST_MSP430_UCB0STATW) {
+        HostMsp430_set(reg, (g_spi.shifting || g_spi.txbufFull) ? UCBUSY : 0);
+    }
+
+    return &g_registers[reg];
+}
+
+uint16_t HostMsp430_readDmaIv(void)
+{
+    uint32_t ctl = *HostMsp430_access(HOST_MSP430_DMA0CTL);
+
+    if (ctl & DMAIFG) {
+        HostMsp430_set(HOST_MSP430_DMA0CTL, ctl & ~DMAIFG);
+        return DMAIV_DMA0IFG;
+    }
+
+    return 0;
+}
+
+//*****************************************************************************
+//
+//! Returns the status register.  A loop polling it lets the models, and the
+//! interrupts they raise, run.
+//
+//*****************************************************************************
+uint16_t HostMsp430_getSR(void)
+{
+    HostMsp430_cycles++;
+    HostMsp430_run();
+
+    return g_sr;
+}
+
+void HostMsp430_setGIE(uint8_t enable)
+{
+    if (enable) {
+        g_sr |= GIE;
+        HostMsp430_run();
+    } else {
+        g_sr &= ~GIE;
+    }
+}
+
+//*****************************************************************************
+//
+//! Writes a DMA address register given its 16-bit address.
+//
+//*****************************************************************************
+void HostMsp430_writeAddr(uint16_t addr, unsigned long value)
+{
+    if (addr == (uint16_t)(uintptr_t)&DMA0SA) {
+        g_dma.sourceReg = value;
+    } else if (addr == (uint16_t)(uintptr_t)&DMA0DA) {
+        g_dma.destReg = value;
+    }
+}
+
+const HostMsp430_SpiStats *HostMsp430_getSpiStats(void)
+{
+    return &g_spiStats;
+}
+
+void HostMsp430_clearSpiStats(void)
+{
+    // A write is only seen at the next access; count it before clearing.
+    HostMsp430_applyWrites();
+    g_spiStats = (HostMsp430_SpiStats){ 0 };
+}
+
+//*****************************************************************************
+//
+//! Returns the conversion result for an ADC12 memory register.
+//!
+//! \param channel is the ADC12MEMx index being read.
+//!
+//! Reading a conversion result means the firmware is polling an input, so the
+//! idle hook is run first.
+//!
+//! \return Returns the scripted result, or mid-scale without a hook.
+//
+//*****************************************************************************
+uint16_t HostMsp430_readAdc(uint8_t channel)
+{
+    if (g_idleHook) {
+        g_idleHook();
+    }
+
+    if (g_adcHook) {
+        return g_adcHook(channel);
+    }
+
+    return HOST_ADC_IDLE_VALUE;
+}
+
+//*****************************************************************************
+//
+//! Advances the virtual clock by the given number of cycles, running the
+//! peripheral models and their interrupts meanwhile.
+//
+//*****************************************************************************
+void HostMsp430_delayCycles(uint32_t cycles)
+{
+    if ((cycles >= HOST_IDLE_DELAY_CYCLES) && g_idleHook) {
+        g_idleHook();
+    }
+
+    HostMsp430_cycles += cycles;
+    HostMsp430_run();
+}
+
+void HostMsp430_setAdcHook(uint16_t (*hook)(uint8_t channel))
+{
+    g_adcHook = hook;
+}
+
+//*****************************************************************************
+//
+//! Installs a function called whenever the firmware stops to wait.
+//!
+//! The hook runs before every ADC read and every delay of a millisecond or
+//! more.  Host tools use it to find the end of each drawn screen.
+//
+//*****************************************************************************
+void HostMsp430_setIdleHook(void (*hook)(void))
+{
+    g_idleHook = hook;
+}
+
+#endif // __MSP430__
@@ -0,0 +1,245 @@
+// msp430fr6989.h (host)
+// Stand-in for the TI device header so that the LCD driver, grlib and the
+// trainer hardware layer can be compiled and run on a Linux host.
+//
+// Most peripheral registers are plain variables (see msp430_host.c).  The
+// ones the LCD transport drives (eUSCI_B0, DMA channel 0, Timer_B0 CCR0, DC'
+// and RESET) are backed by models instead: every access runs the models up
+// to the virtual clock and charges the CPU for it, so the polling loops of
+// LcdDriver/lower_driver.c take as long as on the target and its interrupt
+// handlers run when the hardware would raise them.  Reads that have to
+// produce data (the ADC result registers) are routed through
+// HostMsp430_readAdc() so a test program can script the joystick, and
+// __delay_cycles() advances the virtual clock instead of spinning.
+
+#ifndef HOST_MSP430FR6989_H_
+#define HOST_MSP430FR6989_H_
+
+#include <stdint.h>
+
+//*****************************************************************************
+//
+// Register list.  Each entry becomes "extern volatile uint16_t NAME;" here and
+// a definition in msp430_host.c.
+//
+//*****************************************************************************
+#define HOST_MSP430_REGISTERS(X)                                              \
+    X(WDTCTL) X(PM5CTL0) X(FRCTL0)                                            \
+    X(CSCTL0_H) X(CSCTL1) X(CSCTL3)                                           \
+    X(P1SEL0) X(P1SEL1) X(P1DIR) X(P1OUT)                                     \
+    X(P2SEL0) X(P2SEL1) X(P2DIR)                                              \
+    X(P8SEL0) X(P8SEL1)                                                       \
+    X(P9SEL0) X(P9SEL1) X(P9DIR)                                              \
+    X(UCB0CTLW0) X(UCB0BRW)                                                   \
+    X(DMA0SA) X(DMA0DA)                                                       \
+    X(ADC12CTL0) X(ADC12CTL1) X(ADC12CTL2) X(ADC12CTL3)                       \
+    X(ADC12MCTL0) X(ADC12MCTL1)                                               \
+    X(TA1CTL) X(TA1EX0)                                                       \
+    X(TB0CCTL5) X(TB0CCTL6) X(TB0CCR5) X(TB0CCR6)
+
+#define HOST_MSP430_DECLARE(name) extern volatile uint16_t name;
+HOST_MSP430_REGISTERS(HOST_MSP430_DECLARE)
+#undef HOST_MSP430_DECLARE
+
+//*****************************************************************************
+//
+// Modelled registers.  Each name expands to the register returned by
+// HostMsp430_access(), which first brings the models up to date.  They are
+// held in 32 bits, so that any 16-bit write to UCB0TXBUF can be detected.
+//
+//*****************************************************************************
+#define HOST_MSP430_MODELLED(X)                                               \
+    X(P2OUT) X(P9OUT)                                                         \
+    X(UCB0STATW) X(UCB0TXBUF) X(UCB0IFG)                                      \
+    X(DMACTL0) X(DMA0CTL) X(DMA0SZ)                                           \
+    X(TB0CTL) X(TB0CCTL0) X(TB0CCR0)
+
+#define HOST_MSP430_ENUM(name) HOST_MSP430_##name,
+typedef enum HostMsp430_Register
+{
+    HOST_MSP430_MODELLED(HOST_MSP430_ENUM)
+    HOST_MSP430_MODELLED_COUNT
+} HostMsp430_Register;
+#undef HOST_MSP430_ENUM
+
+extern volatile uint32_t *HostMsp430_access(HostMsp430_Register reg);
+
+#define P2OUT           (*HostMsp430_access(HOST_MSP430_P2OUT))
+#define P9OUT           (*HostMsp430_access(HOST_MSP430_P9OUT))
+#define UCB0STATW       (*HostMsp430_access(HOST_MSP430_UCB0STATW))
+#define UCB0TXBUF       (*HostMsp430_access(HOST_MSP430_UCB0TXBUF))
+#define UCB0IFG         (*HostMsp430_access(HOST_MSP430_UCB0IFG))
+#define DMACTL0         (*HostMsp430_access(HOST_MSP430_DMACTL0))
+#define DMA0CTL         (*HostMsp430_access(HOST_MSP430_DMA0CTL))
+#define DMA0SZ          (*HostMsp430_access(HOST_MSP430_DMA0SZ))
+#define TB0CTL          (*HostMsp430_access(HOST_MSP430_TB0CTL))
+#define TB0CCTL0        (*HostMsp430_access(HOST_MSP430_TB0CCTL0))
+#define TB0CCR0         (*HostMsp430_access(HOST_MSP430_TB0CCR0))
+
+// Reading the DMA interrupt vector clears the flag it reports.
+#define DMAIV           (HostMsp430_readDmaIv())
+
+extern uint16_t HostMsp430_readDmaIv(void);
+
+//*****************************************************************************
+//
+// Intrinsics.  The status register only holds GIE.  __data16_write_addr()
+// takes the 16-bit address of DMA0SA or DMA0DA, which on the host is the
+// truncated address of its variable, and a full host pointer.
+//
+//*****************************************************************************
+#define __get_SR_register()     (HostMsp430_getSR())
+#define __enable_interrupt()    HostMsp430_setGIE(1)
+#define __disable_interrupt()   HostMsp430_setGIE(0)
+#define __even_in_range(v, r)   (v)
+#define __interrupt
+
+#define __data16_write_addr(addr, value)                                      \
+    do {                                                                      \
+        _Pragma("GCC diagnostic push")                                        \
+        _Pragma("GCC diagnostic ignored \"-Wpointer-to-int-cast\"")           \
+        HostMsp430_writeAddr((addr), (value));                                \
+        _Pragma("GCC diagnostic pop")                                         \
+    } while (0)
+
+extern uint16_t HostMsp430_getSR(void);
+extern void HostMsp430_setGIE(uint8_t enable);
+extern void HostMsp430_writeAddr(uint16_t addr, unsigned long value);
+
+//*****************************************************************************
+//
+//! Bus statistics of the eUSCI_B0 model.  An overrun is a write to
+//! UCB0TXBUF while it still held a byte, which is lost; a DC' glitch is a
+//! change of P2.3 while a byte was being shifted out, which the panel may
+//! take with the wrong DC'.  Either is a driver bug.
+//
+//*****************************************************************************
+typedef struct HostMsp430_SpiStats
+{
+    uint32_t cpuBytes;              //!< Bytes written by the CPU.
+    uint32_t dmaBytes;              //!< Bytes written by DMA channel 0.
+    uint32_t dmaBlocks;             //!< DMA blocks started.
+    uint32_t overruns;              //!< Writes to a full UCB0TXBUF.
+    uint32_t dcGlitches;            //!< DC' changes with a byte in flight.
+} HostMsp430_SpiStats;
+
+extern const HostMsp430_SpiStats *HostMsp430_getSpiStats(void);
+extern void HostMsp430_clearSpiStats(void);
+
+//*****************************************************************************
+//
+// Scripted ADC conversion results and the virtual CPU clock.
+//
+//*****************************************************************************
+#define ADC12MEM0       (HostMsp430_readAdc(0))
+#define ADC12MEM1       (HostMsp430_readAdc(1))
+
+// Timer_A1 free-running at SMCLK/64.
+#define TA1R            ((uint16_t)(HostMsp430_cycles >> 6))
+
+extern uint64_t HostMsp430_cycles;
+
+extern uint16_t HostMsp430_readAdc(uint8_t channel);
+extern void HostMsp430_delayCycles(uint32_t cycles);
+extern void HostMsp430_setAdcHook(uint16_t (*hook)(uint8_t channel));
+extern void HostMsp430_setIdleHook(void (*hook)(void));
+
+#define __delay_cycles(n)   HostMsp430_delayCycles(n)
+#define __no_operation()    ((void)0)
+
+//*****************************************************************************
+//
+// Bit and field definitions used by the firmware.
+//
+//*****************************************************************************
+#define BIT0                (0x0001)
+#define BIT1                (0x0002)
+#define BIT2                (0x0004)
+#define BIT3                (0x0008)
+#define BIT4                (0x0010)
+#define BIT5                (0x0020)
+#define BIT6                (0x0040)
+#define BIT7                (0x0080)
+
+#define WDTPW               (0x5A00)
+#define WDTHOLD             (0x0080)
+#define LOCKLPM5            (0x0001)
+
+#define FRCTLPW             (0xA500)
+#define NWAITS_1            (0x0010)
+
+#define CSKEY_H             (0xA5)
+#define DCORSEL             (0x0040)
+#define DCOFSEL_4           (0x0008)
+#define DCOFSEL_7           (0x000E)
+#define DIVM0               (0x0001)
+#define DIVM1               (0x0002)
+#define DIVM2               (0x0004)
+#define DIVS0               (0x0010)
+#define DIVS1               (0x0020)
+#define DIVS2               (0x0040)
+
+#define UCSWRST             (0x0001)
+#define UCSSEL_2            (0x0080)
+#define UCSYNC              (0x0100)
+#define UCMODE_0            (0x0000)
+#define UCMST               (0x0800)
+#define UC7BIT              (0x1000)
+#define UCMSB               (0x2000)
+#define UCCKPL              (0x4000)
+#define UCCKPH              (0x8000)
+#define UCBUSY              (0x0001)
+#define UCRXIFG             (0x0001)
+#define UCTXIFG             (0x0002)
+
+#define DMA0TSEL_31         (0x001F)
+#define DMA0TSEL__UCB0TXIFG0 (0x0013)
+#define DMAEN               (0x0010)
+#define DMAIFG              (0x0008)
+#define DMAIE               (0x0004)
+#define DMADT_0             (0x0000)
+#define DMASRCINCR_0        (0x0000)
+#define DMASRCINCR_3        (0x0300)
+#define DMADSTINCR_0        (0x0000)
+#define DMASBDB             (0x00C0)
+#define DMAIV_DMA0IFG       (0x0002)
+#define DMAIV_DMA2IFG       (0x0006)
+
+#define GIE                 (0x0008)
+
+#define ADC12SC             (0x0001)
+#define ADC12ENC            (0x0002)
+#define ADC12ON             (0x0010)
+#define ADC12MSC            (0x0080)
+#define ADC12SHT0_4         (0x0400)
+#define ADC12SHT0_15        (0x0F00)
+#define ADC12BUSY           (0x0001)
+#define ADC12CONSEQ_1       (0x0002)
+#define ADC12SSEL_0         (0x0000)
+#define ADC12DIV_0          (0x0000)
+#define ADC12SHP            (0x0200)
+#define ADC12SHS_0          (0x0000)
+#define ADC12RES_2          (0x0020)
+#define ADC12CSTARTADD_0    (0x0000)
+#define ADC12INCH_4         (0x0004)
+#define ADC12INCH_10        (0x000A)
+#define ADC12EOS            (0x0080)
+#define ADC12VRSEL_0        (0x0000)
+
+#define TASSEL__SMCLK       (0x0200)
+#define ID__8               (0x00C0)
+#define MC__CONTINUOUS      (0x0020)
+#define TAIDEX_7            (0x0007)
+
+#define TBCLR               (0x0004)
+#define MC__STOP            (0x0000)
+#define MC__UP              (0x0010)
+#define TBSSEL__SMCLK       (0x0200)
+#define MC_3                (0x0030)
+#define CCIFG               (0x0001)
+#define OUT                 (0x0004)
+#define CCIE                (0x0010)
+#define OUTMOD_0            (0x0000)
+#define OUTMOD_7            (0x00E0)
+
+#endif // HOST_MSP430FR6989_H_
@@ -0,0 +1,356 @@
+// screen_gen.c
+// Build-time renderer for the trainer's static screens.  Each screen is drawn
+// through grlib into an 8 BPP offscreen image, its palette is cut down to the
+// colors it uses, and it is written out as a grlib image in whichever of the
+// plain and RLE formats is smallest.  Drawing one at runtime is then a plain
+// image draw, with no glyphs to rasterize.
+//
+// Usage: screen_gen ../static_screens    (make screens)
+// writes ../static_screens.c and ../static_screens.h.
+
+#ifndef __MSP430__
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "Grlib/grlib/grlib.h"
+
+extern const Graphics_Image UCF_Logo;
+
+#define GEN_WIDTH       128
+#define GEN_HEIGHT      128
+#define GEN_PIXELS      (GEN_WIDTH * GEN_HEIGHT)
+
+// Where the pixels of an 8 BPP offscreen image start; see offscr8bpp.c.
+#define GEN_OFFSCREEN_PIXELS    (6 + (256 * 3))
+
+// Enough for the worst of the formats: two bytes a pixel in RLE8.
+#define GEN_OUT_BYTES   (GEN_PIXELS * 2)
+
+typedef void (*Gen_Draw)(Graphics_Context *context);
+
+static uint8_t g_image[GEN_OFFSCREEN_PIXELS + GEN_PIXELS];
+static uint32_t g_palette[256];
+static uint16_t g_colors;
+
+static uint8_t g_out[GEN_OUT_BYTES];
+static uint8_t g_best[GEN_OUT_BYTES];
+
+//*****************************************************************************
+//
+// The static parts of the screens.  These must draw exactly what
+// music_trainer.c used to draw, as the images replace those calls.
+//
+//*****************************************************************************
+static void Gen_drawTitle(Graphics_Context *context)
+{
+    Graphics_setForegroundColor(context, GRAPHICS_COLOR_YELLOW);
+    Graphics_drawStringCentered(context, (int8_t *)"EEL 4742C",
+                                AUTO_STRING_LENGTH, 64, 10, TRANSPARENT_TEXT);
+    Graphics_drawStringCentered(context, (int8_t *)"Music Trainer",
+                                AUTO_STRING_LENGTH, 64, 25, TRANSPARENT_TEXT);
+
+    Graphics_drawImage(context, &UCF_Logo, 32, 40);
+
+    Graphics_setForegroundColor(context, GRAPHICS_COLOR_CYAN);
+    Graphics_drawStringCentered(context, (int8_t *)"Use the joystick",
+                                AUTO_STRING_LENGTH, 64, 100, TRANSPARENT_TEXT);
+    Graphics_drawStringCentered(context, (int8_t *)"to play!",
+                                AUTO_STRING_LENGTH, 64, 110, TRANSPARENT_TEXT);
+}
+
+// The score line between the two is drawn at runtime.
+static void Gen_drawFinal(Graphics_Context *context)
+{
+    Graphics_setForegroundColor(context, GRAPHICS_COLOR_WHITE);
+    Graphics_drawStringCentered(context, (int8_t *)"Game Over",
+                                AUTO_STRING_LENGTH, 64, 20, TRANSPARENT_TEXT);
+
+    Graphics_setForegroundColor(context, GRAPHICS_COLOR_CYAN);
+    Graphics_drawStringCentered(context, (int8_t *)"Press RESET",
+                                AUTO_STRING_LENGTH, 64, 70, TRANSPARENT_TEXT);
+    Graphics_drawStringCentered(context, (int8_t *)"to play again",
+                                AUTO_STRING_LENGTH, 64, 82, TRANSPARENT_TEXT);
+}
+
+//*****************************************************************************
+//
+// The offscreen palette: every color the screens draw with.  Each is an
+// exact entry, so the nearest-color translation of the offscreen driver
+// keeps it as it is.
+//
+//*****************************************************************************
+static void Gen_addColor(uint32_t color)
+{
+    uint16_t i;
+
+    for (i = 0; i < g_colors; i++)
+    {
+        if (g_palette[i] == color)
+        {
+            return;
+        }
+    }
+    g_palette[g_colors++] = color;
+}
+
+static void Gen_initPalette(void)
+{
+    uint16_t i;
+
+    g_colors = 0;
+    Gen_addColor(GRAPHICS_COLOR_BLACK);
+    Gen_addColor(GRAPHICS_COLOR_WHITE);
+    Gen_addColor(GRAPHICS_COLOR_YELLOW);
+    Gen_addColor(GRAPHICS_COLOR_CYAN);
+    for (i = 0; i < UCF_Logo.numColors; i++)
+    {
+        Gen_addColor(UCF_Logo.pPalette[i]);
+    }
+}
+
+//*****************************************************************************
+//
+// Encoders.  Each returns the number of bytes written to g_out.  Runs of the
+// RLE formats are one pixel plus the count in the upper bits, and run on
+// across rows, as Graphics_drawImage() decodes them.
+//
+//*****************************************************************************
+static uint32_t Gen_encodeRle(const uint8_t *pixels, uint32_t count,
+                              uint8_t bPP)
+{
+    uint16_t maxRun = (bPP == 8) ? 256 : 16;
+    uint32_t length = 0;
+    uint32_t i = 0;
+    uint16_t run;
+
+    while (i < count)
+    {
+        for (run = 1; (i + run < count) && (run < maxRun) &&
+                      (pixels[i + run] == pixels[i]); run++)
+        {
+        }
+
+        if (bPP == 8)
+        {
+            g_out[length++] = run - 1;
+            g_out[length++] = pixels[i];
+        }
+        else
+        {
+            g_out[length++] = ((run - 1) << 4) | pixels[i];
+        }
+        i += run;
+    }
+
+    return length;
+}
+
+// Rows of the plain 4 BPP format start on a byte.
+static uint32_t Gen_encodePlain(const uint8_t *pixels, uint16_t width,
+                                uint16_t height, uint8_t bPP)
+{
+    uint32_t length = 0;
+    uint16_t x, y;
+
+    if (bPP == 8)
+    {
+        memcpy(g_out, pixels, (uint32_t)width * height);
+        return (uint32_t)width * height;
+    }
+
+    for (y = 0; y < height; y++, pixels += width)
+    {
+        for (x = 0; x < width; x += 2)
+        {
+            g_out[length++] = (pixels[x] << 4) |
+                              ((x + 1 < width) ? pixels[x + 1] : 0);
+        }
+    }
+    return length;
+}
+
+//*****************************************************************************
+//
+// Renders one screen, cropped to what differs from the background, and
+// prints it as a grlib image named name.  Its position goes to the header as
+// NAME_X and NAME_Y.
+//
+//*****************************************************************************
+static void Gen_screen(FILE *source, FILE *header, const char *name,
+                       const char *macro, Gen_Draw draw)
+{
+    static const struct
+    {
+        uint8_t format;
+        const char *formatName;
+    } formats[] = {
+        { IMAGE_FMT_4BPP_UNCOMP,    "IMAGE_FMT_4BPP_UNCOMP" },
+        { IMAGE_FMT_4BPP_COMP_RLE4, "IMAGE_FMT_4BPP_COMP_RLE4" },
+        { IMAGE_FMT_8BPP_UNCOMP,    "IMAGE_FMT_8BPP_UNCOMP" },
+        { IMAGE_FMT_8BPP_COMP_RLE8, "IMAGE_FMT_8BPP_COMP_RLE8" },
+    };
+    Graphics_Display offscreen;
+    Graphics_Context context;
+    const uint8_t *image = g_image + GEN_OFFSCREEN_PIXELS;
+    uint8_t pixels[GEN_PIXELS];
+    int16_t remap[256];
+    uint32_t used[256];
+    uint16_t colors = 0;
+    uint16_t xMin = GEN_WIDTH, yMin = GEN_HEIGHT, xMax = 0, yMax = 0;
+    uint16_t x, y, width, height;
+    uint32_t length, bestLength = 0;
+    uint32_t i;
+    uint8_t bPP, best = 0;
+
+    Graphics_initOffscreen8BppImage(&offscreen, g_image, GEN_WIDTH,
+                                    GEN_HEIGHT);
+    Graphics_setOffscreen8BppPalette(&offscreen, g_palette, 0, g_colors);
+    Graphics_initContext(&context, &offscreen);
+    Graphics_setBackgroundColor(&context, GRAPHICS_COLOR_BLACK);
+    GrContextFontSet(&context, &g_sFontFixed6x8);
+    Graphics_clearDisplay(&context);
+    draw(&context);
+
+    //
+    // The background is palette entry 0.  The screen is cleared to it at
+    // runtime, so only the box around the rest has to be stored.
+    //
+    for (y = 0; y < GEN_HEIGHT; y++)
+    {
+        for (x = 0; x < GEN_WIDTH; x++)
+        {
+            if (image[y * GEN_WIDTH + x])
+            {
+                xMin = (x < xMin) ? x : xMin;
+                xMax = (x > xMax) ? x : xMax;
+                yMin = (y < yMin) ? y : yMin;
+                yMax = (y > yMax) ? y : yMax;
+            }
+        }
+    }
+    width = xMax - xMin + 1;
+    height = yMax - yMin + 1;
+
+    //
+    // Keep only the colors used, in order of first use.
+    //
+    memset(remap, -1, sizeof(remap));
+    for (i = 0, y = yMin; y <= yMax; y++)
+    {
+        for (x = xMin; x <= xMax; x++)
+        {
+            uint8_t index = image[y * GEN_WIDTH + x];
+
+            if (remap[index] < 0)
+            {
+                remap[index] = colors;
+                used[colors++] = g_palette[index];
+            }
+            pixels[i++] = remap[index];
+        }
+    }
+
+    for (i = 0; i < sizeof(formats) / sizeof(formats[0]); i++)
+    {
+        bPP = formats[i].format & 0x0F;
+        if ((bPP == 4) && (colors > 16))
+        {
+            continue;
+        }
+
+        length = (formats[i].format & 0xF0) ?
+                 Gen_encodeRle(pixels, (uint32_t)width * height, bPP) :
+                 Gen_encodePlain(pixels, width, height, bPP);
+        if (!bestLength || (length < bestLength))
+        {
+            bestLength = length;
+            best = i;
+            memcpy(g_best, g_out, length);
+        }
+    }
+
+    fprintf(stderr, "%s: %ux%u at (%u, %u), %u colors, %s, %lu bytes\n",
+            name, width, height, xMin, yMin, colors,
+            formats[best].formatName, (unsigned long)bestLength);
+
+    fprintf(source, "\nstatic const unsigned char pixel_%s[] =\n{", name);
+    for (i = 0; i < bestLength; i++)
+    {
+        fprintf(source, "%s0x%02x,", (i % 16) ? " " : "\n", g_best[i]);
+    }
+    fprintf(source, "\n};\n");
+
+    fprintf(source, "\nstatic const uint32_t palette_%s[] =\n{", name);
+    for (i = 0; i < colors; i++)
+    {
+        fprintf(source, "%s0x%06lx,", (i % 4) ? " " : "\n\t",
+                (unsigned long)used[i]);
+    }
+    fprintf(source, "\n};\n");
+
+    fprintf(source, "\nconst tImage %s =\n{\n", name);
+    fprintf(source, "\t%s,\n", formats[best].formatName);
+    fprintf(source, "\t%u,\n\t%u,\n", width, height);
+    fprintf(source, "\t%u,\n", colors);
+    fprintf(source, "\tpalette_%s,\n\tpixel_%s,\n};\n", name, name);
+
+    fprintf(header, "\nextern const Graphics_Image %s;\n", name);
+    fprintf(header, "#define %s_X %u\n", macro, xMin);
+    fprintf(header, "#define %s_Y %u\n", macro, yMin);
+}
+
+int main(int argc, char *argv[])
+{
+    char path[256];
+    FILE *source, *header;
+
+    if (argc != 2)
+    {
+        fprintf(stderr, "usage: screen_gen <output path without .c/.h>\n");
+        return 1;
+    }
+
+    snprintf(path, sizeof(path), "%s.c", argv[1]);
+    source = fopen(path, "w");
+    snprintf(path, sizeof(path), "%s.h", argv[1]);
+    header = fopen(path, "w");
+    if (!source || !header)
+    {
+        perror("screen_gen");
+        return 1;
+    }
+
+    Gen_initPalette();
+
+    fprintf(source, "// static_screens.c\n"
+                    "// The static parts of the trainer's screens, rendered "
+                    "at build time.\n"
+                    "// Generated by host/screen_gen.c (make -C host screens); "
+                    "do not edit.\n\n"
+                    "#include \"GrLib/grlib/grlib.h\"\n");
+
+    fprintf(header, "// static_screens.h\n"
+                    "// The static parts of the trainer's screens, to be "
+                    "drawn at NAME_X, NAME_Y\n"
+                    "// over a screen cleared to black.\n"
+                    "// Generated by host/screen_gen.c (make -C host screens); "
+                    "do not edit.\n\n"
+                    "#ifndef STATIC_SCREENS_H_\n"
+                    "#define STATIC_SCREENS_H_\n\n"
+                    "#include \"GrLib/grlib/grlib.h\"\n");
+
+    Gen_screen(source, header, "Title_Screen", "TITLE_SCREEN",
+               Gen_drawTitle);
+    Gen_screen(source, header, "Final_Screen", "FINAL_SCREEN",
+               Gen_drawFinal);
+
+    fprintf(header, "\n#endif // STATIC_SCREENS_H_\n");
+
+    fclose(source);
+    fclose(header);
+    return 0;
+}
+
+#endif // __MSP430__
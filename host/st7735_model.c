@@ -0,0 +1,420 @@
+// st7735_model.c
+// Host model of the ST7735 controller.  See st7735_model.h.
+
+#ifndef __MSP430__
+
+#include <stdio.h>
+#include <string.h>
+
+#include "LcdDriver/lcd_driver.h"
+#include "st7735_model.h"
+
+//*****************************************************************************
+//
+// Display RAM.  Each entry holds the 6-bit red, green and blue levels the
+// controller stores internally, indexed [row][column] in physical order.
+//
+//*****************************************************************************
+static uint8_t g_ram[ST7735_MODEL_RAM_SIZE][ST7735_MODEL_RAM_SIZE][3];
+
+static ST7735Model_Stats g_stats;
+static ST7735Model_State g_state;
+
+// Command currently receiving parameters, and how many it has received.
+static uint8_t g_command;
+static uint32_t g_paramIndex;
+static uint8_t g_params[6];
+
+// Partially assembled pixel (pixel pair for 12 bits per pixel) while RAMWR
+// data is streaming in.
+static uint8_t g_pixelBytes[3];
+static uint8_t g_pixelIndex;
+
+// Last level of the DC line, used to count transitions.
+static int8_t g_dcLevel;
+
+//*****************************************************************************
+//
+// Stores one pixel at the write pointer and advances the pointer through the
+// address window the way the controller does: columns first, then rows,
+// wrapping back to the top of the window.
+//
+//*****************************************************************************
+static void ST7735Model_storePixel(uint8_t r6, uint8_t g6, uint8_t b6)
+{
+    uint16_t a, b, physCol, physRow;
+
+    //
+    // MV exchanges the roles of the column and row counters, MX and MY
+    // mirror the resulting physical addresses.
+    //
+    if (g_state.madctl & CM_MADCTL_MV) {
+        a = g_state.row;
+        b = g_state.col;
+    } else {
+        a = g_state.col;
+        b = g_state.row;
+    }
+    physCol = (g_state.madctl & CM_MADCTL_MX) ?
+              (ST7735_MODEL_RAM_SIZE - 1 - a) : a;
+    physRow = (g_state.madctl & CM_MADCTL_MY) ?
+              (ST7735_MODEL_RAM_SIZE - 1 - b) : b;
+
+    if ((physCol < ST7735_MODEL_RAM_SIZE) && (physRow < ST7735_MODEL_RAM_SIZE)) {
+        //
+        // The panel's color filter is BGR; without the MADCTL BGR bit the
+        // first component of each pixel lands on the blue subpixel.
+        //
+        if (g_state.madctl & CM_MADCTL_BGR) {
+            g_ram[physRow][physCol][0] = r6;
+            g_ram[physRow][physCol][2] = b6;
+        } else {
+            g_ram[physRow][physCol][0] = b6;
+            g_ram[physRow][physCol][2] = r6;
+        }
+        g_ram[physRow][physCol][1] = g6;
+    }
+    g_stats.pixels++;
+
+    if (++g_state.col > g_state.colEnd) {
+        g_state.col = g_state.colStart;
+        if (++g_state.row > g_state.rowEnd) {
+            g_state.row = g_state.rowStart;
+        }
+    }
+}
+
+// Widens a 4-bit component to the controller's 6 bits.
+static uint8_t ST7735Model_expand4(uint8_t v4)
+{
+    v4 &= 0x0F;
+    return (v4 << 2) | (v4 >> 2);
+}
+
+//*****************************************************************************
+//
+// Collects RAMWR payload bytes into pixels according to COLMOD.
+//
+//*****************************************************************************
+static void ST7735Model_writePixelData(uint8_t data)
+{
+    g_pixelBytes[g_pixelIndex++] = data;
+
+    switch (g_state.colmod & 0x07) {
+        case 0x03:
+            // 12 bits per pixel, two pixels in three bytes:
+            // RRRRGGGG BBBBRRRR GGGGBBBB.  A trailing half pair is never
+            // completed and is dropped by the next command.
+            if (g_pixelIndex == 2) {
+                ST7735Model_storePixel(ST7735Model_expand4(g_pixelBytes[0] >> 4),
+                                       ST7735Model_expand4(g_pixelBytes[0]),
+                                       ST7735Model_expand4(g_pixelBytes[1] >> 4));
+            } else if (g_pixelIndex == 3) {
+                ST7735Model_storePixel(ST7735Model_expand4(g_pixelBytes[1]),
+                                       ST7735Model_expand4(g_pixelBytes[2] >> 4),
+                                       ST7735Model_expand4(g_pixelBytes[2]));
+                g_pixelIndex = 0;
+            }
+            break;
+
+        case 0x06:
+            // 18 bits per pixel: one byte per component, upper six bits used.
+            if (g_pixelIndex == 3) {
+                ST7735Model_storePixel(g_pixelBytes[0] >> 2,
+                                       g_pixelBytes[1] >> 2,
+                                       g_pixelBytes[2] >> 2);
+                g_pixelIndex = 0;
+            }
+            break;
+
+        case 0x05:
+        default:
+            // 16 bits per pixel: RRRRRGGG GGGBBBBB.
+            if (g_pixelIndex == 2) {
+                uint16_t value = ((uint16_t)g_pixelBytes[0] << 8) | g_pixelBytes[1];
+                uint8_t r5 = (value >> 11) & 0x1F;
+                uint8_t b5 = value & 0x1F;
+                ST7735Model_storePixel((r5 << 1) | (r5 >> 4),
+                                       (value >> 5) & 0x3F,
+                                       (b5 << 1) | (b5 >> 4));
+                g_pixelIndex = 0;
+            }
+            break;
+    }
+}
+
+//*****************************************************************************
+//
+//! Puts the model into its hardware reset state.
+//!
+//! Display RAM is cleared to black and all statistics are zeroed.
+//
+//*****************************************************************************
+void ST7735Model_reset(void)
+{
+    memset(g_ram, 0, sizeof(g_ram));
+    memset(&g_stats, 0, sizeof(g_stats));
+    memset(&g_state, 0, sizeof(g_state));
+
+    g_state.colEnd = ST7735_MODEL_RAM_SIZE - 1;
+    g_state.rowEnd = ST7735_MODEL_RAM_SIZE - 1;
+    g_state.colmod = 0x06;
+    g_state.sleeping = 1;
+    g_state.scrollHeight = ST7735_MODEL_RAM_SIZE;
+    g_state.partialEnd = ST7735_MODEL_RAM_SIZE - 1;
+
+    g_command = CM_NOP;
+    g_paramIndex = 0;
+    g_pixelIndex = 0;
+    g_dcLevel = -1;
+}
+
+//*****************************************************************************
+//
+//! Consumes a byte sent with DC low.
+//
+//*****************************************************************************
+void ST7735Model_writeCommand(uint8_t command)
+{
+    if (g_dcLevel != 0) {
+        if (g_dcLevel > 0) {
+            g_stats.dcToggles++;
+        }
+        g_dcLevel = 0;
+    }
+
+    g_stats.commandBytes++;
+    g_stats.commandCount[command]++;
+
+    g_command = command;
+    g_paramIndex = 0;
+    g_pixelIndex = 0;
+
+    switch (command) {
+        case CM_SWRESET:
+            g_state.madctl = 0;
+            g_state.colmod = 0x06;
+            g_state.sleeping = 1;
+            g_state.displayOn = 0;
+            g_state.scrolling = 0;
+            g_state.scrollFixed = 0;
+            g_state.scrollHeight = ST7735_MODEL_RAM_SIZE;
+            g_state.partial = 0;
+            g_state.partialStart = 0;
+            g_state.partialEnd = ST7735_MODEL_RAM_SIZE - 1;
+            break;
+        case CM_NORON:
+            g_state.scrolling = 0;
+            g_state.partial = 0;
+            break;
+        case CM_PTLON:
+            g_state.scrolling = 0;
+            g_state.partial = 1;
+            break;
+        case CM_SLPIN:
+            g_state.sleeping = 1;
+            break;
+        case CM_SLPOUT:
+            g_state.sleeping = 0;
+            break;
+        case CM_DISPOFF:
+            g_state.displayOn = 0;
+            break;
+        case CM_DISPON:
+            g_state.displayOn = 1;
+            break;
+        case CM_RAMWR:
+            g_state.col = g_state.colStart;
+            g_state.row = g_state.rowStart;
+            break;
+        default:
+            break;
+    }
+}
+
+//*****************************************************************************
+//
+//! Consumes a byte sent with DC high.
+//
+//*****************************************************************************
+void ST7735Model_writeData(uint8_t data)
+{
+    if (g_dcLevel != 1) {
+        if (g_dcLevel == 0) {
+            g_stats.dcToggles++;
+        }
+        g_dcLevel = 1;
+    }
+
+    g_stats.dataBytes++;
+    g_stats.commandData[g_command]++;
+
+    if (g_command == CM_RAMWR) {
+        ST7735Model_writePixelData(data);
+        return;
+    }
+
+    if (g_paramIndex < sizeof(g_params)) {
+        g_params[g_paramIndex] = data;
+    }
+    g_paramIndex++;
+
+    switch (g_command) {
+        case CM_CASET:
+            if (g_paramIndex == 4) {
+                g_state.colStart = ((uint16_t)g_params[0] << 8) | g_params[1];
+                g_state.colEnd = ((uint16_t)g_params[2] << 8) | g_params[3];
+            }
+            break;
+        case CM_RASET:
+            if (g_paramIndex == 4) {
+                g_state.rowStart = ((uint16_t)g_params[0] << 8) | g_params[1];
+                g_state.rowEnd = ((uint16_t)g_params[2] << 8) | g_params[3];
+            }
+            break;
+        case CM_SCRLAR:
+            if (g_paramIndex == 6) {
+                g_state.scrollFixed = ((uint16_t)g_params[0] << 8) | g_params[1];
+                g_state.scrollHeight = ((uint16_t)g_params[2] << 8) | g_params[3];
+            }
+            break;
+        case CM_PTLAR:
+            if (g_paramIndex == 4) {
+                g_state.partialStart = ((uint16_t)g_params[0] << 8) | g_params[1];
+                g_state.partialEnd = ((uint16_t)g_params[2] << 8) | g_params[3];
+            }
+            break;
+        case CM_VSCSAD:
+            if (g_paramIndex == 2) {
+                g_state.scrollStart = ((uint16_t)g_params[0] << 8) | g_params[1];
+                g_state.scrolling = 1;
+            }
+            break;
+        case CM_MADCTL:
+            if (g_paramIndex == 1) {
+                g_state.madctl = data;
+            }
+            break;
+        case CM_COLMOD:
+            if (g_paramIndex == 1) {
+                g_state.colmod = data;
+            }
+            break;
+        default:
+            break;
+    }
+}
+
+const ST7735Model_Stats *ST7735Model_getStats(void)
+{
+    return &g_stats;
+}
+
+//*****************************************************************************
+//
+//! Zeroes the bus statistics without touching controller state or RAM.
+//
+//*****************************************************************************
+void ST7735Model_clearStats(void)
+{
+    memset(&g_stats, 0, sizeof(g_stats));
+}
+
+const ST7735Model_State *ST7735Model_getState(void)
+{
+    return &g_state;
+}
+
+//*****************************************************************************
+//
+//! Returns the color of a panel pixel.
+//!
+//! \param x is the X coordinate as seen with LCD_ORIENTATION_UP.
+//! \param y is the Y coordinate as seen with LCD_ORIENTATION_UP.
+//!
+//! The panel is black while asleep or switched off, and in partial mode
+//! outside the partial area.
+//!
+//! \return Returns the pixel as 24-bit RGB (red in the third byte).
+//
+//*****************************************************************************
+uint32_t ST7735Model_getPixel(uint16_t x, uint16_t y)
+{
+    const uint8_t *p;
+    uint16_t line;
+    uint8_t r, g, b;
+
+    if ((x >= ST7735_MODEL_PANEL_SIZE) || (y >= ST7735_MODEL_PANEL_SIZE)) {
+        return 0;
+    }
+
+    //
+    // LCD_ORIENTATION_UP sets MX and MY, so the panel's top-left pixel is the
+    // last row and column of the visible window.
+    //
+    line = ST7735_MODEL_PANEL_ROW + ST7735_MODEL_PANEL_SIZE - 1 - y;
+
+    if (g_state.sleeping || !g_state.displayOn) {
+        return 0;
+    }
+    if (g_state.partial &&
+        ((line < g_state.partialStart) || (line > g_state.partialEnd))) {
+        return 0;
+    }
+
+    //
+    // In scroll mode the lines of the scroll area show memory starting at
+    // the scroll start address, wrapping within the area.
+    //
+    if (g_state.scrolling && g_state.scrollHeight &&
+        (line >= g_state.scrollFixed) &&
+        (line < g_state.scrollFixed + g_state.scrollHeight)) {
+        line = g_state.scrollFixed +
+               (line - g_state.scrollFixed + g_state.scrollStart -
+                g_state.scrollFixed + g_state.scrollHeight) %
+               g_state.scrollHeight;
+    }
+
+    p = g_ram[line][ST7735_MODEL_PANEL_COL + ST7735_MODEL_PANEL_SIZE - 1 - x];
+
+    r = (p[0] << 2) | (p[0] >> 4);
+    g = (p[1] << 2) | (p[1] >> 4);
+    b = (p[2] << 2) | (p[2] >> 4);
+
+    return ((uint32_t)r << 16) | ((uint32_t)g << 8) | b;
+}
+
+//*****************************************************************************
+//
+//! Writes the visible panel to a binary PPM file.
+//!
+//! \param path is the file to create.
+//!
+//! \return Returns 0 on success, -1 if the file could not be written.
+//
+//*****************************************************************************
+int ST7735Model_dumpPPM(const char *path)
+{
+    FILE *fp;
+    uint16_t x, y;
+
+    fp = fopen(path, "wb");
+    if (!fp) {
+        return -1;
+    }
+
+    fprintf(fp, "P6\n%d %d\n255\n", ST7735_MODEL_PANEL_SIZE,
+            ST7735_MODEL_PANEL_SIZE);
+    for (y = 0; y < ST7735_MODEL_PANEL_SIZE; y++) {
+        for (x = 0; x < ST7735_MODEL_PANEL_SIZE; x++) {
+            uint32_t rgb = ST7735Model_getPixel(x, y);
+            fputc((rgb >> 16) & 0xFF, fp);
+            fputc((rgb >> 8) & 0xFF, fp);
+            fputc(rgb & 0xFF, fp);
+        }
+    }
+
+    return (fclose(fp) == 0) ? 0 : -1;
+}
+
+#endif // __MSP430__
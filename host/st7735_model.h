@@ -0,0 +1,82 @@
+// st7735_model.h
+// Host model of the ST7735 controller on the Crystalfontz 128x128 panel.
+//
+// The model consumes the same command/data byte stream that the HAL_LCD_*
+// functions put on the SPI bus, tracks the controller state that matters for
+// rendering (address window, write pointer, MADCTL, COLMOD, sleep/display
+// state, vertical scrolling, partial mode) and keeps a copy of display RAM.  Every byte is counted, so the
+// SPI cost of any grlib call can be read back after it returns.
+
+#ifndef ST7735_MODEL_H_
+#define ST7735_MODEL_H_
+
+#include <stdint.h>
+
+//*****************************************************************************
+//
+// Controller RAM geometry.  The panel shows a 128x128 window of a 132x132
+// memory, starting at column 2, row 1.
+//
+//*****************************************************************************
+#define ST7735_MODEL_RAM_SIZE       132
+#define ST7735_MODEL_PANEL_SIZE     128
+#define ST7735_MODEL_PANEL_COL      2
+#define ST7735_MODEL_PANEL_ROW      1
+
+//*****************************************************************************
+//
+//! Bus statistics.  Data bytes are attributed to the command that preceded
+//! them, so commandData[CM_RAMWR] is the pixel payload and
+//! commandData[CM_CASET] + commandData[CM_RASET] is the addressing overhead.
+//
+//*****************************************************************************
+typedef struct ST7735Model_Stats
+{
+    uint32_t commandBytes;          //!< Bytes sent with DC low.
+    uint32_t dataBytes;             //!< Bytes sent with DC high.
+    uint32_t pixels;                //!< Pixels stored into display RAM.
+    uint32_t dcToggles;             //!< Changes of the DC line.
+    uint32_t commandCount[256];     //!< Occurrences of each command.
+    uint32_t commandData[256];      //!< Data bytes following each command.
+} ST7735Model_Stats;
+
+//*****************************************************************************
+//
+//! Controller state visible to host tools.
+//
+//*****************************************************************************
+typedef struct ST7735Model_State
+{
+    uint16_t colStart, colEnd;      //!< Column window from CASET.
+    uint16_t rowStart, rowEnd;      //!< Row window from RASET.
+    uint16_t col, row;              //!< Current write pointer.
+    uint8_t madctl;                 //!< Last MADCTL parameter.
+    uint8_t colmod;                 //!< Last COLMOD parameter.
+    uint8_t sleeping;               //!< Non-zero between SLPIN and SLPOUT.
+    uint8_t displayOn;              //!< Non-zero between DISPON and DISPOFF.
+    uint8_t scrolling;              //!< Non-zero from VSCSAD until NORON.
+    uint16_t scrollFixed;           //!< Top fixed area from SCRLAR.
+    uint16_t scrollHeight;          //!< Scroll area height from SCRLAR.
+    uint16_t scrollStart;           //!< First line shown, from VSCSAD.
+    uint8_t partial;                //!< Non-zero from PTLON until NORON.
+    uint16_t partialStart;          //!< First line shown, from PTLAR.
+    uint16_t partialEnd;            //!< Last line shown, from PTLAR.
+} ST7735Model_State;
+
+extern void ST7735Model_reset(void);
+
+extern void ST7735Model_writeCommand(uint8_t command);
+
+extern void ST7735Model_writeData(uint8_t data);
+
+extern const ST7735Model_Stats *ST7735Model_getStats(void);
+
+extern void ST7735Model_clearStats(void);
+
+extern const ST7735Model_State *ST7735Model_getState(void);
+
+extern uint32_t ST7735Model_getPixel(uint16_t x, uint16_t y);
+
+extern int ST7735Model_dumpPPM(const char *path);
+
+#endif // ST7735_MODEL_H_
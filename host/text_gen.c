@@ -0,0 +1,183 @@
+// text_gen.c
+// Build-time measurement of the trainer's constant strings.  Every string
+// literal in a source file is measured in the trainer's font with
+// Graphics_getStringWidth(), and its width written out as a macro, so it can
+// be drawn centered with Graphics_drawStringCenteredWidth() and no width
+// pass at runtime.  Format strings, and literals with escapes, are skipped.
+//
+// Usage: text_gen ../music_trainer.c ../static_text    (make text)
+// writes ../static_text.h.  Both host builds rerun it before compiling
+// music_trainer.c whenever the source has changed, so the committed header
+// follows the strings; a literal edited so that its macro name changes then
+// fails to compile rather than keep the old width.
+
+#ifndef __MSP430__
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "Grlib/grlib/grlib.h"
+#include "gen_util.h"
+#include "static_fonts.h"
+
+// The font trainer_hw.c sets up.  A character the subset lacks is measured
+// as the glyph drawn in its place.
+#define GEN_FONT        g_sFontFixed6x8Subset
+#define GEN_FONT_NAME   "g_sFontFixed6x8Subset"
+
+#define GEN_SOURCE_BYTES    65536
+#define GEN_STRINGS         128
+#define GEN_STRING_BYTES    64
+#define GEN_NAME_BYTES      (sizeof("TEXT_WIDTH_") + GEN_STRING_BYTES)
+
+static char g_source[GEN_SOURCE_BYTES];
+static char g_strings[GEN_STRINGS][GEN_STRING_BYTES];
+static char g_names[GEN_STRINGS][GEN_NAME_BYTES];
+static uint16_t g_count;
+
+//*****************************************************************************
+//
+// Makes the macro name of a string: TEXT_WIDTH_ and the string upper-cased,
+// with each run of other characters made one underscore.
+//
+//*****************************************************************************
+static void Gen_name(const char *string, char *name)
+{
+    char *p = name + sprintf(name, "TEXT_WIDTH_");
+    char *start = p;
+
+    for (; *string; string++)
+    {
+        if (isalnum((unsigned char)*string))
+        {
+            *p++ = toupper((unsigned char)*string);
+        }
+        else if ((p > start) && (p[-1] != '_'))
+        {
+            *p++ = '_';
+        }
+    }
+    if ((p > start) && (p[-1] == '_'))
+    {
+        p--;
+    }
+    *p = 0;
+}
+
+//*****************************************************************************
+//
+// Adds a literal, unless it is a format, has escapes, or is already in.
+// Two literals that make the same name are an error.
+//
+//*****************************************************************************
+static int Gen_add(const char *start, size_t length, const char *path)
+{
+    char name[GEN_NAME_BYTES];
+    char string[GEN_STRING_BYTES];
+    uint16_t i;
+
+    if ((length == 0) || (length >= GEN_STRING_BYTES) ||
+        memchr(start, '%', length) || memchr(start, '\\', length))
+    {
+        return 0;
+    }
+    memcpy(string, start, length);
+    string[length] = 0;
+
+    Gen_name(string, name);
+    if (!strcmp(name, "TEXT_WIDTH_"))
+    {
+        return 0;
+    }
+
+    for (i = 0; i < g_count; i++)
+    {
+        if (!strcmp(g_names[i], name))
+        {
+            if (strcmp(g_strings[i], string))
+            {
+                fprintf(stderr, "text_gen: %s: \"%s\" and \"%s\" are both "
+                        "%s\n", path, g_strings[i], string, name);
+                return -1;
+            }
+            return 0;
+        }
+    }
+
+    if (g_count == GEN_STRINGS)
+    {
+        fprintf(stderr, "text_gen: more than %d strings\n", GEN_STRINGS);
+        return -1;
+    }
+    strcpy(g_strings[g_count], string);
+    strcpy(g_names[g_count], name);
+    g_count++;
+    return 0;
+}
+
+int main(int argc, char *argv[])
+{
+    Graphics_Context context;
+    char path[256];
+    size_t bytes;
+    uint16_t i;
+    FILE *f;
+
+    if (argc != 3)
+    {
+        fprintf(stderr, "usage: text_gen source.c output\n");
+        return 1;
+    }
+
+    f = fopen(argv[1], "r");
+    if (!f)
+    {
+        fprintf(stderr, "text_gen: cannot read %s\n", argv[1]);
+        return 1;
+    }
+    bytes = fread(g_source, 1, sizeof(g_source) - 1, f);
+    fclose(f);
+    g_source[bytes] = 0;
+
+    if (Gen_scan(g_source, argv[1], Gen_add) < 0)
+    {
+        return 1;
+    }
+
+    memset(&context, 0, sizeof(context));
+    context.font = (const Graphics_Font *)&GEN_FONT;
+
+    snprintf(path, sizeof(path), "%s.h", argv[2]);
+    f = fopen(path, "w");
+    if (!f)
+    {
+        fprintf(stderr, "text_gen: cannot write %s\n", path);
+        return 1;
+    }
+
+    fprintf(f, "// static_text.h\n"
+               "// Widths in " GEN_FONT_NAME " of the trainer's string "
+               "literals, for\n"
+               "// Graphics_drawStringCenteredWidth().\n"
+               "// Generated by host/text_gen.c (make -C host text); "
+               "do not edit.\n\n"
+               "#ifndef STATIC_TEXT_H_\n"
+               "#define STATIC_TEXT_H_\n\n");
+    for (i = 0; i < g_count; i++)
+    {
+        fprintf(f, "#define %-36s %3ld  // \"%s\"\n", g_names[i],
+                (long)Graphics_getStringWidth(&context,
+                                              (const int8_t *)g_strings[i],
+                                              AUTO_STRING_LENGTH),
+                g_strings[i]);
+    }
+    fprintf(f, "\n#endif // STATIC_TEXT_H_\n");
+    fclose(f);
+
+    printf("%s: %u strings\n", path, g_count);
+    return 0;
+}
+
+#endif // __MSP430__
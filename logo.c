@@ -163,7 +163,7 @@ static const unsigned char pixel_logo4BPP_UNCOMP[] =
 0x9c, 0x4c, 0x9c, 0x4c, 0x9c, 0x4c, 0x9c, 0x4c, 0x92, 0x9c, 0x9c, 0x4c, 0x9c, 0x4c, 0x4c, 0x9c, 0x9c, 0x9c, 0x3c, 0x92, 0x9c, 0x4c, 0x9c, 0x4c, 0x9c, 0x4c, 0x92, 0x4c, 0x9c, 0x4c, 0x9c, 0x4c, 0x9c, 0x4c, 0xcc, 0x4c, 0x9c, 0x92, 0x92, 0x9c, 0x9c, 0x4c, 0x4c, 0x9c, 0x42, 0x9c, 0x9c, 0x9c, 0x9c, 0x4c, 0x9c, 0x4c, 0x9c, 0x4c, 0x9c, 0x4c, 0x9c, 0x4c, 0x9c, 0x4c, 0x9c, 0x4c, 0x9c, 0x4c
 };
 
-static const unsigned long palette_logo4BPP_UNCOMP[]=
+static const uint32_t palette_logo4BPP_UNCOMP[]=
 {
 	0x000000, 	0x9e9c9d, 	0x1f1f1f, 	0x463007, 
 	0x221e1b, 	0x1d1b1c, 	0x977d29, 	0xecba0d, 
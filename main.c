@@ -8,12 +8,13 @@ void main(void)
 {
     WDTCTL = WDTPW | WDTHOLD;   // Stop watchdog
     PM5CTL0 &= ~LOCKLPM5;       // Unlock GPIO
+    __enable_interrupt();       // LCD DMA and backlight fades
 
     MusicTrainer_Init();
     MusicTrainer_Run();
 
-    // Idle forever
+    // Idle forever; the display powers down when left alone
     while (1) {
-        __no_operation();
+        LCD_Idle();
     }
 }
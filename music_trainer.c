@@ -6,14 +6,24 @@
 #include <stdio.h>
 
 #include "Grlib/grlib/grlib.h"
+#include "LcdDriver/lcd_list.h"
+#include "LcdDriver/lcd_screen.h"
 #include "music_trainer.h"
-
-// from logo.c
-extern const Graphics_Image UCF_Logo;
+#include "static_screens.h"
+#include "static_text.h"
 
 // defined in trainer_hw.c
 extern Graphics_Context g_sContext;
 
+// Screens are recorded, then shown redrawing only what changed.  The lists
+// are in FRAM with the framebuffer, as RAM is only 2 KB.
+#define SCREEN_LIST_BYTES 256
+
+#pragma PERSISTENT(g_screenLists)
+static uint8_t g_screenLists[2][SCREEN_LIST_BYTES] = { { 0 } };
+
+static Lcd_Screen g_screen;
+
 //  Note table C major
 
 typedef struct {
@@ -48,12 +58,15 @@ static uint8_t select_num_questions(void);
 static void play_startup_tune(void);
 static void run_quiz(uint8_t numQuestions);
 static void generate_question(uint8_t notes[3]);
-static uint8_t wait_for_updown_choice(const char *line1, const char *line2);
+static uint8_t wait_for_updown_choice(const char *line1, int16_t width1,
+                                      const char *line2, int16_t width2);
 
 void MusicTrainer_Init(void)
 {
     Init_ClockSystem();
     LCD_InitGraphics();
+    Crystalfontz128x128_ScreenInit(&g_screen, g_screenLists[0],
+                                   g_screenLists[1], SCREEN_LIST_BYTES);
     Joystick_Init();
     Buzzer_Init();
 
@@ -83,176 +96,168 @@ void MusicTrainer_Run(void)
 
 static void draw_title_screen(void)
 {
-    Graphics_clearDisplay(&g_sContext);
-
-    Graphics_setForegroundColor(&g_sContext, GRAPHICS_COLOR_YELLOW);
-    GrContextFontSet(&g_sContext, &g_sFontFixed6x8);
-
-    Graphics_drawStringCentered(&g_sContext,
-                                (int8_t *)"EEL 4742C",
-                                AUTO_STRING_LENGTH,
-                                64, 10, TRANSPARENT_TEXT);
-
-    Graphics_drawStringCentered(&g_sContext,
-                                (int8_t *)"Music Trainer",
-                                AUTO_STRING_LENGTH,
-                                64, 25, TRANSPARENT_TEXT);
-
-    Graphics_drawImage(&g_sContext, &UCF_Logo, 32, 40);
-
-    Graphics_setForegroundColor(&g_sContext, GRAPHICS_COLOR_CYAN);
-    Graphics_drawStringCentered(&g_sContext,
-                                (int8_t *)"Use the joystick",
-                                AUTO_STRING_LENGTH,
-                                64, 100, TRANSPARENT_TEXT);
-    Graphics_drawStringCentered(&g_sContext,
-                                (int8_t *)"to play!",
-                                AUTO_STRING_LENGTH,
-                                64, 110, TRANSPARENT_TEXT);
+    Lcd_DisplayList *list = Crystalfontz128x128_ScreenList(&g_screen);
+
+    Crystalfontz128x128_ScreenBegin(&g_screen);
+    Crystalfontz128x128_ListClear(list);
+    Crystalfontz128x128_ListDrawImage(list, &Title_Screen,
+                                      TITLE_SCREEN_X, TITLE_SCREEN_Y);
+    Crystalfontz128x128_ScreenShow(&g_screen, &g_sContext);
 }
 
 static void draw_selection_screen(uint8_t questions)
 {
+    Lcd_DisplayList *list = Crystalfontz128x128_ScreenList(&g_screen);
     char buf[20];
 
-    Graphics_clearDisplay(&g_sContext);
+    Crystalfontz128x128_ScreenBegin(&g_screen);
+    Crystalfontz128x128_ListClear(list);
 
-    Graphics_setForegroundColor(&g_sContext, GRAPHICS_COLOR_WHITE);
-    Graphics_drawStringCentered(&g_sContext,
-                                (int8_t *)"Select # Questions",
-                                AUTO_STRING_LENGTH,
-                                64, 20, TRANSPARENT_TEXT);
+    Crystalfontz128x128_ListSetForeground(list, GRAPHICS_COLOR_WHITE);
+    Crystalfontz128x128_ListDrawStringCenteredWidth(list,
+                                                    (int8_t *)"Select # Questions",
+                                                    AUTO_STRING_LENGTH,
+                                                    64, 20, TRANSPARENT_TEXT,
+                                                    TEXT_WIDTH_SELECT_QUESTIONS);
 
     snprintf(buf, sizeof(buf), "%d", (int)questions);
-    Graphics_setForegroundColor(&g_sContext, GRAPHICS_COLOR_YELLOW);
-    Graphics_drawStringCentered(&g_sContext,
-                                (int8_t *)buf,
-                                AUTO_STRING_LENGTH,
-                                64, 45, TRANSPARENT_TEXT);
-
-    Graphics_setForegroundColor(&g_sContext, GRAPHICS_COLOR_CYAN);
-    Graphics_drawStringCentered(&g_sContext,
-                                (int8_t *)"LEFT: -1   RIGHT: +1",
-                                AUTO_STRING_LENGTH,
-                                64, 75, TRANSPARENT_TEXT);
-
-    Graphics_drawStringCentered(&g_sContext,
-                                (int8_t *)"UP: start",
-                                AUTO_STRING_LENGTH,
-                                64, 90, TRANSPARENT_TEXT);
+    Crystalfontz128x128_ListSetForeground(list, GRAPHICS_COLOR_YELLOW);
+    Crystalfontz128x128_ListDrawStringCentered(list,
+                                               (int8_t *)buf,
+                                               AUTO_STRING_LENGTH,
+                                               64, 45, TRANSPARENT_TEXT);
+
+    Crystalfontz128x128_ListSetForeground(list, GRAPHICS_COLOR_CYAN);
+    Crystalfontz128x128_ListDrawStringCenteredWidth(list,
+                                                    (int8_t *)"LEFT: -1   RIGHT: +1",
+                                                    AUTO_STRING_LENGTH,
+                                                    64, 75, TRANSPARENT_TEXT,
+                                                    TEXT_WIDTH_LEFT_1_RIGHT_1);
+
+    Crystalfontz128x128_ListDrawStringCenteredWidth(list,
+                                                    (int8_t *)"UP: start",
+                                                    AUTO_STRING_LENGTH,
+                                                    64, 90, TRANSPARENT_TEXT,
+                                                    TEXT_WIDTH_UP_START);
+    Crystalfontz128x128_ScreenShow(&g_screen, &g_sContext);
 }
 
 static void draw_question_header(uint8_t qIndex, uint8_t total, uint8_t score)
 {
+    Lcd_DisplayList *list = Crystalfontz128x128_ScreenList(&g_screen);
     char buf[20];
 
-    Graphics_clearDisplay(&g_sContext);
+    Crystalfontz128x128_ScreenBegin(&g_screen);
+    Crystalfontz128x128_ListClear(list);
 
-    Graphics_setForegroundColor(&g_sContext, GRAPHICS_COLOR_WHITE);
-    Graphics_drawStringCentered(&g_sContext,
-                                (int8_t *)"Music Trainer",
-                                AUTO_STRING_LENGTH,
-                                64, 8, TRANSPARENT_TEXT);
+    Crystalfontz128x128_ListSetForeground(list, GRAPHICS_COLOR_WHITE);
+    Crystalfontz128x128_ListDrawStringCenteredWidth(list,
+                                                    (int8_t *)"Music Trainer",
+                                                    AUTO_STRING_LENGTH,
+                                                    64, 8, TRANSPARENT_TEXT,
+                                                    TEXT_WIDTH_MUSIC_TRAINER);
 
     snprintf(buf, sizeof(buf), "Q %d / %d", (int)qIndex, (int)total);
-    Graphics_drawStringCentered(&g_sContext,
-                                (int8_t *)buf,
-                                AUTO_STRING_LENGTH,
-                                64, 22, TRANSPARENT_TEXT);
+    Crystalfontz128x128_ListDrawStringCentered(list,
+                                               (int8_t *)buf,
+                                               AUTO_STRING_LENGTH,
+                                               64, 22, OPAQUE_TEXT);
 
     snprintf(buf, sizeof(buf), "Score: %d", (int)score);
-    Graphics_drawStringCentered(&g_sContext,
-                                (int8_t *)buf,
-                                AUTO_STRING_LENGTH,
-                                64, 36, TRANSPARENT_TEXT);
+    Crystalfontz128x128_ListDrawStringCentered(list,
+                                               (int8_t *)buf,
+                                               AUTO_STRING_LENGTH,
+                                               64, 36, OPAQUE_TEXT);
 }
 
 static void draw_sequence_info(uint8_t notes[3])
 {
+    Lcd_DisplayList *list = Crystalfontz128x128_ScreenList(&g_screen);
+
     (void)notes;
 
-    Graphics_setForegroundColor(&g_sContext, GRAPHICS_COLOR_YELLOW);
-    Graphics_drawStringCentered(&g_sContext,
-                                (int8_t *)"3 notes played: 1,2,3",
-                                AUTO_STRING_LENGTH,
-                                64, 50, TRANSPARENT_TEXT);
+    Crystalfontz128x128_ListSetForeground(list, GRAPHICS_COLOR_YELLOW);
+    Crystalfontz128x128_ListDrawStringCenteredWidth(list,
+                                                    (int8_t *)"3 notes played: 1,2,3",
+                                                    AUTO_STRING_LENGTH,
+                                                    64, 50, TRANSPARENT_TEXT,
+                                                    TEXT_WIDTH_3_NOTES_PLAYED_1_2_3);
 }
 
 static void draw_feedback_screen(uint8_t qIndex, uint8_t total,
                                  uint8_t score, uint8_t correct,
                                  const char *correctText)
 {
+    Lcd_DisplayList *list = Crystalfontz128x128_ScreenList(&g_screen);
     char buf[20];
 
-    Graphics_clearDisplay(&g_sContext);
+    Crystalfontz128x128_ScreenBegin(&g_screen);
+    Crystalfontz128x128_ListClear(list);
 
-    Graphics_setForegroundColor(&g_sContext, GRAPHICS_COLOR_WHITE);
+    Crystalfontz128x128_ListSetForeground(list, GRAPHICS_COLOR_WHITE);
     snprintf(buf, sizeof(buf), "Q %d / %d", (int)qIndex, (int)total);
-    Graphics_drawStringCentered(&g_sContext,
-                                (int8_t *)buf,
-                                AUTO_STRING_LENGTH,
-                                64, 15, TRANSPARENT_TEXT);
+    Crystalfontz128x128_ListDrawStringCentered(list,
+                                               (int8_t *)buf,
+                                               AUTO_STRING_LENGTH,
+                                               64, 15, TRANSPARENT_TEXT);
 
     snprintf(buf, sizeof(buf), "Score: %d", (int)score);
-    Graphics_drawStringCentered(&g_sContext,
-                                (int8_t *)buf,
-                                AUTO_STRING_LENGTH,
-                                64, 30, TRANSPARENT_TEXT);
+    Crystalfontz128x128_ListDrawStringCentered(list,
+                                               (int8_t *)buf,
+                                               AUTO_STRING_LENGTH,
+                                               64, 30, TRANSPARENT_TEXT);
 
     if (correct) {
-        Graphics_setForegroundColor(&g_sContext, GRAPHICS_COLOR_GREEN);
-        Graphics_drawStringCentered(&g_sContext,
-                                    (int8_t *)"Correct!",
-                                    AUTO_STRING_LENGTH,
-                                    64, 55, TRANSPARENT_TEXT);
+        Crystalfontz128x128_ListSetForeground(list, GRAPHICS_COLOR_GREEN);
+        Crystalfontz128x128_ListDrawStringCenteredWidth(list,
+                                                        (int8_t *)"Correct!",
+                                                        AUTO_STRING_LENGTH,
+                                                        64, 55, TRANSPARENT_TEXT,
+                                                        TEXT_WIDTH_CORRECT);
     } else {
-        Graphics_setForegroundColor(&g_sContext, GRAPHICS_COLOR_RED);
-        Graphics_drawStringCentered(&g_sContext,
-                                    (int8_t *)"Wrong",
-                                    AUTO_STRING_LENGTH,
-                                    64, 55, TRANSPARENT_TEXT);
+        Crystalfontz128x128_ListSetForeground(list, GRAPHICS_COLOR_RED);
+        Crystalfontz128x128_ListDrawStringCenteredWidth(list,
+                                                        (int8_t *)"Wrong",
+                                                        AUTO_STRING_LENGTH,
+                                                        64, 55, TRANSPARENT_TEXT,
+                                                        TEXT_WIDTH_WRONG);
     }
 
-    Graphics_setForegroundColor(&g_sContext, GRAPHICS_COLOR_CYAN);
-    Graphics_drawStringCentered(&g_sContext,
-                                (int8_t *)"Answer:",
-                                AUTO_STRING_LENGTH,
-                                64, 75, TRANSPARENT_TEXT);
-
-    Graphics_setForegroundColor(&g_sContext, GRAPHICS_COLOR_YELLOW);
-    Graphics_drawStringCentered(&g_sContext,
-                                (int8_t *)correctText,
-                                AUTO_STRING_LENGTH,
-                                64, 90, TRANSPARENT_TEXT);
+    Crystalfontz128x128_ListSetForeground(list, GRAPHICS_COLOR_CYAN);
+    Crystalfontz128x128_ListDrawStringCenteredWidth(list,
+                                                    (int8_t *)"Answer:",
+                                                    AUTO_STRING_LENGTH,
+                                                    64, 75, TRANSPARENT_TEXT,
+                                                    TEXT_WIDTH_ANSWER);
+
+    Crystalfontz128x128_ListSetForeground(list, GRAPHICS_COLOR_YELLOW);
+    Crystalfontz128x128_ListDrawStringCentered(list,
+                                               (int8_t *)correctText,
+                                               AUTO_STRING_LENGTH,
+                                               64, 90, TRANSPARENT_TEXT);
+    Crystalfontz128x128_ScreenShow(&g_screen, &g_sContext);
 }
 
 static void draw_final_screen(uint8_t score, uint8_t total)
 {
+    Lcd_DisplayList *list = Crystalfontz128x128_ScreenList(&g_screen);
     char buf[20];
 
-    Graphics_clearDisplay(&g_sContext);
-
-    Graphics_setForegroundColor(&g_sContext, GRAPHICS_COLOR_WHITE);
-    Graphics_drawStringCentered(&g_sContext,
-                                (int8_t *)"Game Over",
-                                AUTO_STRING_LENGTH,
-                                64, 20, TRANSPARENT_TEXT);
+    Crystalfontz128x128_ScreenBegin(&g_screen);
+    Crystalfontz128x128_ListClear(list);
+    Crystalfontz128x128_ListDrawImage(list, &Final_Screen,
+                                      FINAL_SCREEN_X, FINAL_SCREEN_Y);
 
     snprintf(buf, sizeof(buf), "Score: %d / %d", (int)score, (int)total);
-    Graphics_drawStringCentered(&g_sContext,
-                                (int8_t *)buf,
-                                AUTO_STRING_LENGTH,
-                                64, 40, TRANSPARENT_TEXT);
-
-    Graphics_setForegroundColor(&g_sContext, GRAPHICS_COLOR_CYAN);
-    Graphics_drawStringCentered(&g_sContext,
-                                (int8_t *)"Press RESET",
-                                AUTO_STRING_LENGTH,
-                                64, 70, TRANSPARENT_TEXT);
-    Graphics_drawStringCentered(&g_sContext,
-                                (int8_t *)"to play again",
-                                AUTO_STRING_LENGTH,
-                                64, 82, TRANSPARENT_TEXT);
+    Crystalfontz128x128_ListSetForeground(list, GRAPHICS_COLOR_WHITE);
+    Crystalfontz128x128_ListDrawStringCentered(list,
+                                               (int8_t *)buf,
+                                               AUTO_STRING_LENGTH,
+                                               64, 40, TRANSPARENT_TEXT);
+    Crystalfontz128x128_ScreenShow(&g_screen, &g_sContext);
+
+    // Left up until RESET; only the text needs to stay shown
+    LCD_SetIdleArea(16, 87);
 }
 
 //  Startup tune
@@ -308,23 +313,29 @@ static uint8_t select_num_questions(void)
     }
 }
 
-static uint8_t wait_for_updown_choice(const char *line1, const char *line2)
+static uint8_t wait_for_updown_choice(const char *line1, int16_t width1,
+                                      const char *line2, int16_t width2)
 {
+    Lcd_DisplayList *list = Crystalfontz128x128_ScreenList(&g_screen);
+
     // Make sure joystick is centered
     while (Joystick_GetDir() != DIR_CENTER) {
         ;
     }
     delay_ms(80);
 
-    Graphics_setForegroundColor(&g_sContext, GRAPHICS_COLOR_CYAN);
-    Graphics_drawStringCentered(&g_sContext,
-                                (int8_t *)line1,
-                                AUTO_STRING_LENGTH,
-                                64, 75, TRANSPARENT_TEXT);
-    Graphics_drawStringCentered(&g_sContext,
-                                (int8_t *)line2,
-                                AUTO_STRING_LENGTH,
-                                64, 90, TRANSPARENT_TEXT);
+    Crystalfontz128x128_ListSetForeground(list, GRAPHICS_COLOR_CYAN);
+    Crystalfontz128x128_ListDrawStringCenteredWidth(list,
+                                                    (int8_t *)line1,
+                                                    AUTO_STRING_LENGTH,
+                                                    64, 75, TRANSPARENT_TEXT,
+                                                    width1);
+    Crystalfontz128x128_ListDrawStringCenteredWidth(list,
+                                                    (int8_t *)line2,
+                                                    AUTO_STRING_LENGTH,
+                                                    64, 90, TRANSPARENT_TEXT,
+                                                    width2);
+    Crystalfontz128x128_ScreenShow(&g_screen, &g_sContext);
 
     while (1) {
         JoystickDir dir = Joystick_GetDir();
@@ -368,6 +379,7 @@ static void run_quiz(uint8_t numQuestions)
         uint8_t correctUp1, correctUp2;
         uint8_t ansUp1, ansUp2;
         char correctText[16];
+        Lcd_DisplayList *list;
 
         generate_question(notes);
 
@@ -377,6 +389,7 @@ static void run_quiz(uint8_t numQuestions)
 
         draw_question_header(q, numQuestions, score);
         draw_sequence_info(notes);
+        Crystalfontz128x128_ScreenShow(&g_screen, &g_sContext);
 
         // Play the notes
         uint8_t i;
@@ -386,28 +399,37 @@ static void run_quiz(uint8_t numQuestions)
         Buzzer_Stop();
 
         // Q1. 2nd note vs first.
-        Graphics_setForegroundColor(&g_sContext, GRAPHICS_COLOR_WHITE);
-        Graphics_drawStringCentered(&g_sContext,
-                                    (int8_t *)"1) 2nd vs 1st note",
-                                    AUTO_STRING_LENGTH,
-                                    64, 65, TRANSPARENT_TEXT);
+        list = Crystalfontz128x128_ScreenList(&g_screen);
+        Crystalfontz128x128_ListSetForeground(list, GRAPHICS_COLOR_WHITE);
+        Crystalfontz128x128_ListDrawStringCenteredWidth(list,
+                                                        (int8_t *)"1) 2nd vs 1st note",
+                                                        AUTO_STRING_LENGTH,
+                                                        64, 65, OPAQUE_TEXT,
+                                                        TEXT_WIDTH_1_2ND_VS_1ST_NOTE);
+        Crystalfontz128x128_ScreenShow(&g_screen, &g_sContext);
 
         ansUp1 = wait_for_updown_choice("UP = later higher",
-                                        "DOWN = later lower");
+                                        TEXT_WIDTH_UP_LATER_HIGHER,
+                                        "DOWN = later lower",
+                                        TEXT_WIDTH_DOWN_LATER_LOWER);
 
         // Q2. 3rd note vs 2nd.
-        Graphics_clearDisplay(&g_sContext);
         draw_question_header(q, numQuestions, score);
         draw_sequence_info(notes);
 
-        Graphics_setForegroundColor(&g_sContext, GRAPHICS_COLOR_WHITE);
-        Graphics_drawStringCentered(&g_sContext,
-                                    (int8_t *)"2) 3rd vs 2nd note",
-                                    AUTO_STRING_LENGTH,
-                                    64, 65, TRANSPARENT_TEXT);
+        list = Crystalfontz128x128_ScreenList(&g_screen);
+        Crystalfontz128x128_ListSetForeground(list, GRAPHICS_COLOR_WHITE);
+        Crystalfontz128x128_ListDrawStringCenteredWidth(list,
+                                                        (int8_t *)"2) 3rd vs 2nd note",
+                                                        AUTO_STRING_LENGTH,
+                                                        64, 65, OPAQUE_TEXT,
+                                                        TEXT_WIDTH_2_3RD_VS_2ND_NOTE);
+        Crystalfontz128x128_ScreenShow(&g_screen, &g_sContext);
 
         ansUp2 = wait_for_updown_choice("UP = later higher",
-                                        "DOWN = later lower");
+                                        TEXT_WIDTH_UP_LATER_HIGHER,
+                                        "DOWN = later lower",
+                                        TEXT_WIDTH_DOWN_LATER_LOWER);
 
         // both answers must be right
         uint8_t correct = (ansUp1 == correctUp1) && (ansUp2 == correctUp2);
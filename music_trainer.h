@@ -17,6 +17,8 @@ void delay_ms(uint16_t ms);
 // Clock and LCD
 void Init_ClockSystem(void);
 void LCD_InitGraphics(void);
+void LCD_SetIdleArea(uint16_t y0, uint16_t y1);
+void LCD_Idle(void);
 
 // Joystick
 void Joystick_Init(void);
@@ -0,0 +1,92 @@
+// static_fonts.c
+// g_sFontFixed6x8 cut down to the characters of the trainer's strings.
+// Generated by host/font_subset.c (make -C host fonts); do not edit.
+
+#include "static_fonts.h"
+
+// 59 of the 90 characters ' ' to 'y'; the rest draw as '.'
+static const uint8_t g_pucFontFixed6x8SubsetData[472] =
+{
+      8,   6,   0,   0,   0,   0,   0,   0,   8,   6,  32, 130,
+      8,   0,   2,   0,   8,   6,  81,  79, 148, 249,  69,   0,
+      8,   6,  64, 129,   4,  16, 132,   0,   8,   6,   0, 130,
+     62,  32, 128,   0,   8,   6,   0,   0,   0,  96, 132,   0,
+      8,   6,   0,   0,  62,   0,   0,   0,   8,   6,   0,   0,
+      0,   1, 134,   0,   8,   6,   0,  33,   8,  66,   0,   0,
+      8,   6, 114,  41, 170, 202,  39,   0,   8,   6,  33, 130,
+      8,  32, 135,   0,   8,   6, 114,  32, 132,  33,  15, 128,
+      8,   6, 248,  66,   4,  10,  39,   0,   8,   6,  16, 197,
+     36, 248,  65,   0,   8,   6, 250,  15,   2,  10,  39,   0,
+      8,   6,  49,   8,  60, 138,  39,   0,   8,   6, 248,  33,
+      8,  65,   4,   0,   8,   6, 114,  40, 156, 138,  39,   0,
+      8,   6, 114,  40, 158,   8,  70,   0,   8,   6,   1, 134,
+      0,  97, 128,   0,   8,   6,   0,  15, 128, 248,   0,   0,
+      8,   6, 114,  40, 162, 250,  40, 128,   8,   6, 242,  40,
+    188, 138,  47,   0,   8,   6, 114,  40,  32, 130,  39,   0,
+      8,   6, 226,  72, 162, 138,  78,   0,   8,   6, 250,   8,
+     60, 130,  15, 128,   8,   6, 250,   8,  60, 130,   8,   0,
+      8,   6, 114,  40,  46, 138,  39, 128,   8,   6, 138,  40,
+    190, 138,  40, 128,   8,   6, 112, 130,   8,  32, 135,   0,
+      8,   6, 130,   8,  32, 130,  15, 128,   8,   6, 139, 106,
+    170, 138,  40, 128,   8,   6, 138,  44, 170, 154,  40, 128,
+      8,   6, 114,  40, 162, 138,  39,   0,   8,   6, 242,  40,
+    188, 130,   8,   0,   8,   6, 114,  40, 162, 170,  70, 128,
+      8,   6, 242,  40, 188, 162,  72, 128,   8,   6, 122,   8,
+     28,   8,  47,   0,   8,   6, 248, 130,   8,  32, 130,   0,
+      8,   6, 138,  40, 162, 138,  39,   0,   8,   6, 138,  40,
+    170, 170, 165,   0,   8,   6,   0,   7,   2, 122,  39, 128,
+      8,   6,   0,   7,  32, 130,  39,   0,   8,   6,   8,  38,
+    166, 138,  39, 128,   8,   6,   0,   7,  34, 250,   7,   0,
+      8,   6,   1, 232, 162, 120,  39,   0,   8,   6, 130,  11,
+     50, 138,  40, 128,   8,   6,  32,   6,   8,  32, 135,   0,
+      8,   6,  96, 130,   8,  32, 135,   0,   8,   6,   0,  11,
+     50, 138,  40, 128,   8,   6,   0,   7,  34, 138,  39,   0,
+      8,   6,   0,  15,  34, 242,   8,   0,   8,   6,   0,  11,
+     50, 130,   8,   0,   8,   6,   0,   7,  32, 112,  47,   0,
+      8,   6,  65,  14,  16,  65,  35,   0,   8,   6,   0,   8,
+    162, 138, 102, 128,   8,   6,   0,   8, 162, 137,  66,   0,
+      8,   6,   0,   8, 162, 170, 165,   0,   8,   6,   0,   8,
+    162, 120,  39,   0,
+};
+
+static const uint16_t g_pusFontFixed6x8SubsetOffset[90] =
+{
+        0,     8,    56,    16,    56,    56,    56,    56,
+       56,    24,    56,    32,    40,    48,    56,    64,
+       72,    80,    88,    96,   104,   112,   120,   128,
+      136,   144,   152,    56,    56,   160,    56,    56,
+       56,   168,   176,   184,   192,   200,   208,   216,
+      224,   232,    56,    56,   240,   248,   256,   264,
+      272,   280,   288,   296,   304,   312,    56,   320,
+       56,    56,    56,    56,    56,    56,    56,    56,
+       56,   328,    56,   336,   344,   352,    56,   360,
+      368,   376,    56,    56,   384,    56,   392,   400,
+      408,    56,   416,   424,   432,   440,   448,   456,
+       56,   464,
+};
+
+static const uint8_t g_pucFontFixed6x8SubsetWidths[90] =
+{
+      6,   6,   6,   6,   6,   6,   6,   6,   6,   6,   6,   6,
+      6,   6,   6,   6,   6,   6,   6,   6,   6,   6,   6,   6,
+      6,   6,   6,   6,   6,   6,   6,   6,   6,   6,   6,   6,
+      6,   6,   6,   6,   6,   6,   6,   6,   6,   6,   6,   6,
+      6,   6,   6,   6,   6,   6,   6,   6,   6,   6,   6,   6,
+      6,   6,   6,   6,   6,   6,   6,   6,   6,   6,   6,   6,
+      6,   6,   6,   6,   6,   6,   6,   6,   6,   6,   6,   6,
+      6,   6,   6,   6,   6,   6,
+};
+
+const Graphics_FontEx g_sFontFixed6x8Subset =
+{
+    GRAPHICS_FONT_FMT_EX_UNCOMPRESSED,
+      6,    // maxWidth
+      8,    // height
+      7,    // baseline
+     32,    // first
+    121,    // last
+    g_pusFontFixed6x8SubsetOffset,
+    g_pucFontFixed6x8SubsetData,
+    g_pucFontFixed6x8SubsetWidths,
+    true
+};
@@ -0,0 +1,13 @@
+// static_fonts.h
+// The trainer's font, holding only the characters its strings draw.
+// Generated by host/font_subset.c (make -C host fonts); do not edit.
+
+#ifndef STATIC_FONTS_H_
+#define STATIC_FONTS_H_
+
+#include "GrLib/grlib/grlib.h"
+
+// g_sFontFixed6x8, characters ' ' to 'y'
+extern const Graphics_FontEx g_sFontFixed6x8Subset;
+
+#endif // STATIC_FONTS_H_
@@ -0,0 +1,513 @@
+// static_screens.c
+// The static parts of the trainer's screens, rendered at build time.
+// Generated by host/screen_gen.c (make -C host screens); do not edit.
+
+#include "GrLib/grlib/grlib.h"
+
+static const unsigned char pixel_Title_Screen[] =
+{
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x01, 0x11, 0x11,
+0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x11, 0x11, 0x00, 0x00, 0x10, 0x00,
+0x11, 0x10, 0x00, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+0x10, 0x00, 0x00, 0x01, 0x00, 0x01, 0x10, 0x01, 0x00, 0x01, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00,
+0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x00, 0x00, 0x10, 0x00, 0x10, 0x10, 0x00,
+0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x01, 0x11, 0x10, 0x01, 0x11, 0x10, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+0x10, 0x00, 0x01, 0x00, 0x01, 0x00, 0x10, 0x00, 0x00, 0x10, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00,
+0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x00, 0x10, 0x00, 0x01, 0x11, 0x11, 0x00,
+0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x10, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x10, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x01, 0x11, 0x11,
+0x01, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x01,
+0x11, 0x11, 0x00, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11,
+0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x01, 0x10, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01,
+0x00, 0x01, 0x00, 0x11, 0x10, 0x00, 0x11, 0x00, 0x00, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x01,
+0x00, 0x01, 0x01, 0x10, 0x00, 0x11, 0x10, 0x00, 0x11, 0x00, 0x01, 0x01, 0x10, 0x00, 0x11, 0x10,
+0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00,
+0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x10, 0x01, 0x00, 0x00, 0x01, 0x00,
+0x01, 0x00, 0x01, 0x10, 0x01, 0x01, 0x00, 0x01, 0x01, 0x10, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x01,
+0x00, 0x01, 0x00, 0x11, 0x10, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+0x00, 0x01, 0x00, 0x00, 0x00, 0x11, 0x11, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x01, 0x11, 0x11,
+0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x01, 0x00, 0x11, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00,
+0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00,
+0x01, 0x00, 0x01, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00,
+0x11, 0x01, 0x01, 0x11, 0x10, 0x00, 0x11, 0x10, 0x00, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x01,
+0x00, 0x01, 0x00, 0x00, 0x00, 0x11, 0x11, 0x00, 0x11, 0x10, 0x01, 0x00, 0x01, 0x00, 0x11, 0x10,
+0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x23, 0x23, 0x23, 0x43, 0x23, 0x23, 0x23, 0x43, 0x23, 0x23, 0x23, 0x43, 0x23, 0x23, 0x23, 0x43,
+0x23, 0x23, 0x23, 0x43, 0x23, 0x23, 0x23, 0x43, 0x24, 0x23, 0x24, 0x23, 0x23, 0x43, 0x23, 0x43,
+0x23, 0x23, 0x43, 0x43, 0x24, 0x23, 0x24, 0x23, 0x23, 0x23, 0x23, 0x43, 0x23, 0x23, 0x23, 0x43,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x32, 0x32, 0x52, 0x32, 0x32, 0x32, 0x52,
+0x32, 0x32, 0x32, 0x52, 0x32, 0x32, 0x32, 0x52, 0x32, 0x32, 0x32, 0x52, 0x32, 0x52, 0x32, 0x32,
+0x32, 0x54, 0x52, 0x54, 0x32, 0x22, 0x52, 0x55, 0x34, 0x54, 0x32, 0x55, 0x52, 0x32, 0x32, 0x32,
+0x32, 0x52, 0x32, 0x32, 0x32, 0x32, 0x32, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
+0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x45, 0x23, 0x45, 0x23, 0x23, 0x43, 0x45, 0x56,
+0x66, 0x77, 0x66, 0x77, 0x76, 0x66, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0x32, 0x52, 0x32, 0x52, 0x32, 0x52, 0x32,
+0x52, 0x32, 0x52, 0x32, 0x52, 0x32, 0x52, 0x32, 0x52, 0x32, 0x52, 0x52, 0x32, 0x32, 0x54, 0x54,
+0x54, 0x52, 0x32, 0x54, 0x55, 0x67, 0x77, 0x88, 0x9a, 0xaa, 0xba, 0xaa, 0x88, 0x88, 0x65, 0x54,
+0x54, 0x32, 0x52, 0x32, 0x52, 0x32, 0x52, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x23, 0x43, 0x23, 0x23, 0x23, 0x43, 0x23, 0x23, 0x23, 0x43, 0x23, 0x23, 0x23, 0x43, 0x23, 0x23,
+0x23, 0x43, 0x23, 0x23, 0x23, 0x43, 0x23, 0x23, 0x23, 0x23, 0x43, 0x36, 0x77, 0x88, 0xaa, 0xa9,
+0xaa, 0xa9, 0x88, 0x87, 0x66, 0x55, 0x44, 0x43, 0x23, 0x23, 0x23, 0x23, 0x23, 0x43, 0x23, 0x23,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x52, 0x32, 0x52, 0x32, 0x52, 0x32, 0x52,
+0x32, 0x52, 0x32, 0x52, 0x32, 0x52, 0x32, 0x52, 0x32, 0x32, 0x32, 0x54, 0x32, 0x52, 0x32, 0x54,
+0x32, 0x53, 0x56, 0x78, 0x9a, 0xba, 0xba, 0xba, 0xaa, 0x87, 0x65, 0x54, 0x32, 0x52, 0x32, 0x32,
+0x32, 0x52, 0x32, 0x32, 0x32, 0x52, 0x32, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
+0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x24, 0x25, 0x46, 0x78, 0xaa, 0xa9, 0xa9, 0xab, 0xaa,
+0x87, 0x55, 0x43, 0x24, 0x43, 0x23, 0x23, 0x24, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0x32, 0x52, 0x32, 0x52, 0x32, 0x52, 0x32,
+0x52, 0x32, 0x52, 0x32, 0x52, 0x32, 0x52, 0x32, 0x32, 0x32, 0x52, 0x52, 0x52, 0x52, 0x54, 0x52,
+0x56, 0x78, 0xaa, 0xba, 0x9a, 0xba, 0xba, 0x87, 0x65, 0x52, 0x32, 0x52, 0x52, 0x32, 0x52, 0x54,
+0x52, 0x52, 0x52, 0x32, 0x52, 0x32, 0x52, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x23, 0x23, 0x23, 0x43, 0x23, 0x23, 0x23, 0x43, 0x23, 0x23, 0x23, 0x43, 0x23, 0x23, 0x23, 0x43,
+0x23, 0x45, 0x43, 0x43, 0x24, 0x43, 0x25, 0x43, 0x68, 0xaa, 0xaa, 0xa9, 0xa9, 0xaa, 0xa7, 0x30,
+0x23, 0x45, 0x66, 0x43, 0x23, 0x23, 0x24, 0x43, 0x23, 0x43, 0x23, 0x23, 0x23, 0x23, 0x23, 0x43,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x32, 0x32, 0x52, 0x32, 0x32, 0x32, 0x52,
+0x32, 0x32, 0x32, 0x52, 0x32, 0x32, 0x32, 0x52, 0x34, 0x52, 0x32, 0x52, 0x54, 0x33, 0x67, 0x66,
+0x8a, 0xba, 0xba, 0x9a, 0xba, 0xb8, 0x75, 0x54, 0x52, 0x55, 0x77, 0x52, 0x52, 0x54, 0x54, 0x54,
+0x32, 0x52, 0x32, 0x32, 0x32, 0x32, 0x32, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
+0x23, 0x23, 0x23, 0x23, 0x25, 0x27, 0x86, 0x79, 0xbb, 0xa9, 0xa9, 0xaa, 0xa9, 0x86, 0x40, 0x25,
+0x23, 0x46, 0x88, 0x65, 0x23, 0x23, 0x45, 0x43, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0x32, 0x52, 0x32, 0x52, 0x32, 0x52, 0x32,
+0x52, 0x32, 0x52, 0x32, 0x52, 0x32, 0x52, 0x32, 0x52, 0x32, 0x52, 0x54, 0x68, 0x88, 0x77, 0xaa,
+0x9b, 0x9a, 0xba, 0x9a, 0xb8, 0x62, 0x32, 0x34, 0x54, 0x68, 0x9a, 0x86, 0x63, 0x32, 0x54, 0x32,
+0x32, 0x32, 0x54, 0x32, 0x52, 0x32, 0x52, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x23, 0x43, 0x23, 0x23, 0x23, 0x43, 0x23, 0x23, 0x23, 0x43, 0x23, 0x23, 0x23, 0x43, 0x23, 0x23,
+0x23, 0x43, 0x25, 0x35, 0x88, 0x87, 0x79, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0x86, 0x43, 0x24, 0x23,
+0x26, 0x79, 0xab, 0xa7, 0x63, 0x33, 0x24, 0x43, 0x23, 0x23, 0x23, 0x23, 0x23, 0x43, 0x23, 0x23,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x52, 0x32, 0x52, 0x32, 0x52, 0x32, 0x52,
+0x32, 0x52, 0x32, 0x52, 0x32, 0x52, 0x32, 0x52, 0x32, 0x32, 0x55, 0x78, 0xaa, 0x77, 0xaa, 0x9b,
+0x9a, 0x9a, 0x9a, 0xa8, 0x65, 0x54, 0x32, 0x22, 0x78, 0x9a, 0xba, 0xba, 0x88, 0x65, 0x52, 0x52,
+0x32, 0x54, 0x32, 0x32, 0x32, 0x52, 0x32, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
+0x43, 0x25, 0x56, 0x8b, 0xa7, 0x78, 0xa9, 0xab, 0xa9, 0xa9, 0xab, 0x86, 0x43, 0x23, 0x25, 0x23,
+0x68, 0xaa, 0xa9, 0xaa, 0x87, 0x25, 0x43, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0x32, 0x52, 0x32, 0x52, 0x32, 0x52, 0x32,
+0x52, 0x32, 0x52, 0x32, 0x52, 0x32, 0x52, 0x32, 0x52, 0x55, 0x7a, 0xba, 0x96, 0x8a, 0x9a, 0xba,
+0x9b, 0xbb, 0x9a, 0x75, 0x52, 0x32, 0x33, 0x55, 0x56, 0x7a, 0xba, 0xa8, 0x65, 0x52, 0x32, 0x32,
+0x32, 0x52, 0x54, 0x32, 0x52, 0x32, 0x52, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x23, 0x23, 0x23, 0x43, 0x23, 0x23, 0x23, 0x43, 0x23, 0x23, 0x23, 0x43, 0x23, 0x43, 0x23, 0x43,
+0x25, 0x57, 0xaa, 0xaa, 0x28, 0xa9, 0xab, 0x9b, 0xa9, 0xa9, 0xa8, 0x53, 0x23, 0x43, 0x23, 0x43,
+0x23, 0x46, 0xaa, 0x75, 0x23, 0x43, 0x23, 0x43, 0x23, 0x43, 0x23, 0x43, 0x23, 0x23, 0x23, 0x23,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x32, 0x32, 0x52, 0x32, 0x32, 0x32, 0x52,
+0x32, 0x32, 0x32, 0x52, 0x32, 0x32, 0x34, 0x32, 0x36, 0x7a, 0xaa, 0xb8, 0x68, 0xba, 0x9a, 0x9a,
+0x9b, 0x9a, 0xa7, 0x54, 0x32, 0x52, 0x32, 0x52, 0x32, 0x56, 0x88, 0x65, 0x52, 0x52, 0x32, 0x32,
+0x32, 0x52, 0x32, 0x32, 0x52, 0x32, 0x32, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x22, 0x23, 0x23,
+0x47, 0xab, 0xaa, 0xa6, 0x7a, 0xa9, 0xa9, 0xa9, 0xab, 0xaa, 0x86, 0x23, 0x23, 0x23, 0x23, 0x23,
+0x23, 0x25, 0x77, 0x23, 0x23, 0x23, 0x43, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x24, 0x23, 0x23,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0x32, 0x52, 0x32, 0x52, 0x32, 0x52, 0x32,
+0x52, 0x32, 0x52, 0x32, 0x32, 0x54, 0x52, 0x54, 0x68, 0xba, 0x9a, 0x76, 0x9a, 0xba, 0x99, 0xba,
+0x9b, 0xaa, 0x75, 0x32, 0x52, 0x32, 0x54, 0x32, 0x52, 0x52, 0x62, 0x52, 0x52, 0x32, 0x52, 0x32,
+0x54, 0x52, 0x54, 0x52, 0x52, 0x52, 0x32, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x23, 0x43, 0x23, 0x23, 0x23, 0x43, 0x23, 0x23, 0x23, 0x43, 0x23, 0x23, 0x23, 0x20, 0x23, 0x06,
+0x8a, 0xa9, 0xaa, 0x67, 0xa9, 0xa9, 0xa9, 0xab, 0xa9, 0xa8, 0x33, 0x43, 0x23, 0x23, 0x24, 0x23,
+0x23, 0x43, 0x23, 0x43, 0x23, 0x43, 0x24, 0x23, 0x24, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x43,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x52, 0x32, 0x52, 0x32, 0x52, 0x32, 0x52,
+0x32, 0x52, 0x32, 0x52, 0x34, 0x54, 0x35, 0x58, 0xba, 0x9a, 0xa8, 0x68, 0xba, 0xba, 0x9a, 0x9a,
+0xba, 0x97, 0x52, 0x54, 0x32, 0x52, 0x32, 0x52, 0x54, 0x54, 0x32, 0x52, 0x32, 0x52, 0x32, 0x54,
+0x52, 0x54, 0x32, 0x52, 0x34, 0x54, 0x32, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x25, 0x22, 0x25, 0x7a,
+0xa9, 0xaa, 0xa7, 0x68, 0xa9, 0xa9, 0xab, 0xa9, 0xa9, 0xa6, 0x43, 0x23, 0x43, 0x23, 0x23, 0x23,
+0x23, 0x23, 0x23, 0x23, 0x43, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x25, 0x22, 0x23, 0x20,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0x32, 0x52, 0x32, 0x52, 0x32, 0x52, 0x32,
+0x52, 0x32, 0x52, 0x32, 0x52, 0x52, 0x56, 0x8a, 0x9b, 0xba, 0xa6, 0x7a, 0xba, 0x9a, 0xba, 0xba,
+0x9a, 0x96, 0x62, 0x34, 0x52, 0x32, 0x52, 0x32, 0x32, 0x34, 0x52, 0x52, 0x52, 0x32, 0x52, 0x54,
+0x52, 0x32, 0x52, 0x32, 0x55, 0x78, 0x64, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x23, 0x23, 0x23, 0x43, 0x23, 0x23, 0x23, 0x43, 0x23, 0x43, 0x23, 0x43, 0x24, 0x23, 0x48, 0xab,
+0xa9, 0xa9, 0x86, 0x7a, 0xa9, 0xa9, 0xa9, 0xa9, 0xaa, 0x86, 0x24, 0x25, 0x23, 0x23, 0x23, 0x43,
+0x43, 0x43, 0x23, 0x23, 0x24, 0x23, 0x25, 0x35, 0x45, 0x35, 0x23, 0x40, 0x26, 0xc8, 0x33, 0x25,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x32, 0x32, 0x52, 0x32, 0x32, 0x32, 0x52,
+0x32, 0x32, 0x32, 0x52, 0x32, 0x55, 0x68, 0xba, 0xba, 0x9a, 0x86, 0x8a, 0xba, 0x9a, 0xba, 0x9b,
+0xba, 0x86, 0x52, 0x34, 0x32, 0x52, 0x32, 0x32, 0x32, 0x32, 0x32, 0x52, 0x52, 0x66, 0x68, 0x88,
+0x88, 0x77, 0x66, 0x65, 0x58, 0xa8, 0x62, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x25, 0x79, 0xa9,
+0xa9, 0xaa, 0x86, 0xcb, 0xa9, 0xab, 0xa9, 0xa9, 0xaa, 0x86, 0x43, 0x24, 0x23, 0x23, 0x23, 0x23,
+0x43, 0x23, 0x45, 0x46, 0x67, 0x8a, 0xab, 0xa9, 0xa9, 0xaa, 0xa8, 0x86, 0x68, 0xa8, 0x63, 0x23,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0x32, 0x52, 0x32, 0x52, 0x32, 0x52, 0x32,
+0x54, 0x32, 0x54, 0x54, 0x32, 0x36, 0x8a, 0xba, 0x9a, 0xba, 0x76, 0xaa, 0x9a, 0xba, 0x9a, 0xba,
+0x9a, 0x96, 0x52, 0x34, 0x32, 0x32, 0x52, 0x54, 0x54, 0x32, 0x56, 0x78, 0xaa, 0xba, 0x9a, 0xbb,
+0xba, 0xba, 0xba, 0xaa, 0x9a, 0xaa, 0x73, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x23, 0x43, 0x23, 0x23, 0x23, 0x43, 0x23, 0x23, 0x23, 0x43, 0x23, 0x23, 0x24, 0x46, 0x89, 0xab,
+0xab, 0xaa, 0x85, 0xca, 0xa9, 0xa9, 0xa9, 0xa9, 0xaa, 0x86, 0x44, 0x23, 0x23, 0x43, 0x23, 0x25,
+0x23, 0x45, 0x37, 0x8a, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xaa, 0xa9, 0xab, 0xa9, 0x75, 0x23,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x52, 0x32, 0x52, 0x32, 0x52, 0x32, 0x52,
+0x32, 0x52, 0x32, 0x54, 0x22, 0x57, 0xaa, 0x9a, 0xba, 0x9a, 0x75, 0xaa, 0xba, 0x9a, 0xba, 0x9a,
+0xba, 0x97, 0x52, 0x34, 0x32, 0x52, 0x52, 0x54, 0x34, 0x56, 0x7a, 0xba, 0xba, 0x9a, 0xba, 0xba,
+0xba, 0xba, 0x9a, 0xba, 0xba, 0x9a, 0x75, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x25, 0x58, 0xab, 0xab,
+0xa9, 0xaa, 0x86, 0xca, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa7, 0x63, 0x23, 0x23, 0x23, 0x23, 0x23,
+0x45, 0x67, 0xab, 0xa9, 0xa9, 0xab, 0xab, 0xa9, 0xa9, 0xab, 0xa9, 0xa9, 0xa9, 0xaa, 0x86, 0x23,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0x32, 0x52, 0x32, 0x52, 0x32, 0x52, 0x32,
+0x52, 0x32, 0x54, 0x54, 0x55, 0x68, 0xba, 0x9a, 0x9a, 0xba, 0x86, 0x8a, 0x9b, 0xba, 0x9a, 0xba,
+0x9b, 0xb8, 0x62, 0x54, 0x54, 0x52, 0x52, 0x32, 0x56, 0x7a, 0xba, 0x9a, 0x9b, 0xba, 0x9a, 0xba,
+0xbb, 0xba, 0x9b, 0xbb, 0xbb, 0xba, 0x86, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x23, 0x23, 0x23, 0x43, 0x23, 0x23, 0x23, 0x43, 0x43, 0x24, 0x25, 0x43, 0x22, 0x68, 0xab, 0xa9,
+0xa9, 0xa9, 0x86, 0x8a, 0xa9, 0xab, 0xa9, 0xa9, 0xa9, 0xaa, 0x75, 0x23, 0x23, 0x43, 0x24, 0x25,
+0x47, 0xa9, 0xaa, 0xa9, 0xa9, 0xab, 0xab, 0xa9, 0xa9, 0xab, 0xaa, 0xa9, 0xab, 0xaa, 0xc6, 0x35,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x32, 0x32, 0x52, 0x32, 0x32, 0x32, 0x52,
+0x34, 0x52, 0x34, 0x53, 0x62, 0x6a, 0xba, 0x9a, 0xaa, 0x9a, 0x86, 0x7a, 0xba, 0x9a, 0x9a, 0xba,
+0xba, 0xba, 0x86, 0x52, 0x42, 0x32, 0x32, 0x55, 0x78, 0xba, 0x9a, 0x99, 0xba, 0x9a, 0xba, 0x9a,
+0x9a, 0xba, 0xba, 0xba, 0xba, 0xba, 0xa7, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x24, 0x25, 0x45, 0x85, 0x6a, 0xab, 0xa9,
+0xa9, 0xa9, 0x86, 0x6a, 0xa9, 0xa9, 0xa9, 0xa9, 0xab, 0xab, 0xa7, 0x43, 0x23, 0x24, 0x23, 0x47,
+0xaa, 0xa9, 0xa9, 0xa9, 0xa9, 0xab, 0xa9, 0xa9, 0xa9, 0xab, 0xa9, 0x99, 0xab, 0xab, 0xa7, 0x53,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0x32, 0x52, 0x32, 0x52, 0x32, 0x52, 0x32,
+0x34, 0x52, 0x32, 0x55, 0xc5, 0x7a, 0x9b, 0x9a, 0x9a, 0xba, 0x97, 0x6a, 0x9a, 0xba, 0x9a, 0x9a,
+0x9a, 0x9a, 0xb8, 0x62, 0x34, 0x52, 0x55, 0x68, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0x9a, 0xba,
+0xba, 0xba, 0x9a, 0xba, 0x9a, 0xba, 0xb8, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x23, 0x43, 0x23, 0x23, 0x23, 0x43, 0x23, 0x23, 0x24, 0x23, 0x23, 0x46, 0xc5, 0x7a, 0xa9, 0xa9,
+0xab, 0xa9, 0xa7, 0x58, 0xa9, 0xab, 0xa9, 0xab, 0xab, 0xa9, 0xa9, 0x85, 0x43, 0x23, 0x46, 0x8a,
+0xa9, 0xab, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xab, 0xab, 0xa9, 0xaa, 0xab, 0xa9, 0xab, 0xa8, 0x63,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x52, 0x32, 0x52, 0x32, 0x52, 0x32, 0x52,
+0x52, 0x52, 0x32, 0x57, 0xa6, 0x6a, 0xba, 0x9a, 0xba, 0x9a, 0xa8, 0x67, 0xaa, 0x9a, 0xba, 0x9b,
+0x9a, 0xbb, 0x9a, 0x97, 0x52, 0x33, 0x57, 0xaa, 0x9a, 0x9a, 0xba, 0x9a, 0xba, 0x9a, 0xba, 0xba,
+0xba, 0x9a, 0xba, 0x9a, 0xba, 0x9b, 0xba, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x43, 0x23, 0x23, 0x48, 0xc6, 0x6a, 0xa9, 0xaa,
+0xa9, 0xa9, 0xa9, 0x75, 0xca, 0xa9, 0xab, 0xa9, 0xa9, 0xab, 0xab, 0xa8, 0x65, 0x25, 0x78, 0xa9,
+0xa9, 0xa9, 0xa9, 0xab, 0xa9, 0xa9, 0xa9, 0xaa, 0xa8, 0x88, 0xa9, 0xab, 0xa9, 0xa9, 0xaa, 0x75,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0x32, 0x52, 0x32, 0x52, 0x32, 0x52, 0x32,
+0x52, 0x52, 0x32, 0x58, 0xa6, 0x6a, 0xba, 0xba, 0x9a, 0xba, 0xba, 0x85, 0x7a, 0xba, 0x9a, 0xbb,
+0x9a, 0x9b, 0x9a, 0xba, 0x86, 0x56, 0x8b, 0x9a, 0x9b, 0xba, 0xba, 0x9a, 0xba, 0xba, 0xba, 0xba,
+0x66, 0x66, 0x7a, 0xba, 0x9a, 0xba, 0xba, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x23, 0x23, 0x23, 0x43, 0x23, 0x23, 0x23, 0x43, 0x23, 0x43, 0x23, 0x5a, 0xa7, 0x68, 0xa9, 0xa9,
+0xab, 0xab, 0xaa, 0xa6, 0x2a, 0xab, 0xa9, 0xaa, 0xa9, 0xab, 0xa9, 0xa9, 0xa8, 0x36, 0x8a, 0xab,
+0xab, 0xa9, 0xa9, 0x9b, 0xa9, 0xab, 0xa9, 0xa8, 0x23, 0x25, 0x47, 0xab, 0xa9, 0xa9, 0xaa, 0x85,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x32, 0x32, 0x52, 0x32, 0x32, 0x32, 0x52,
+0x32, 0x32, 0x34, 0x6a, 0xa8, 0x68, 0x9a, 0x9a, 0xba, 0x9a, 0x9a, 0xa8, 0x67, 0xba, 0x9a, 0xba,
+0xba, 0x9a, 0xba, 0x9a, 0xba, 0x76, 0x68, 0xaa, 0xba, 0x9a, 0x9a, 0xba, 0xba, 0x9a, 0x9a, 0xa7,
+0x54, 0x32, 0x56, 0x7a, 0xba, 0x9a, 0xba, 0xa6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x25, 0x6a, 0xa8, 0x68, 0xa9, 0xab,
+0xa9, 0xa9, 0xa9, 0xaa, 0x66, 0xca, 0x9b, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xab, 0xa7, 0x66, 0x8a,
+0xa9, 0xab, 0xab, 0xa9, 0xa9, 0xab, 0xa9, 0xa6, 0x45, 0x23, 0x40, 0x6a, 0xa9, 0xab, 0xab, 0xc5,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0x32, 0x52, 0x32, 0x52, 0x32, 0x52, 0x32,
+0x52, 0x34, 0x53, 0x7a, 0xb8, 0x68, 0xaa, 0x9a, 0x9a, 0xba, 0x9a, 0xba, 0x86, 0x7a, 0x9a, 0xbb,
+0x9a, 0x9a, 0xba, 0xba, 0x9b, 0xba, 0x86, 0x68, 0x9a, 0xba, 0x9a, 0x9a, 0x9a, 0x9a, 0x9a, 0xa6,
+0x55, 0x32, 0x34, 0x68, 0xba, 0xba, 0x9a, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x23, 0x43, 0x23, 0x23, 0x23, 0x43, 0x23, 0x23, 0x23, 0x23, 0x25, 0x7a, 0xaa, 0x76, 0xa9, 0xa9,
+0xa9, 0xa9, 0xab, 0xa9, 0xa7, 0x67, 0xa9, 0xab, 0xa9, 0xa9, 0xa9, 0xab, 0xab, 0xa9, 0xa7, 0x66,
+0x8a, 0xa9, 0xab, 0xab, 0xa9, 0xa9, 0xaa, 0xa6, 0x43, 0x20, 0x23, 0x46, 0xaa, 0xaa, 0xa8, 0x55,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x52, 0x32, 0x52, 0x32, 0x52, 0x32, 0x52,
+0x32, 0x34, 0x54, 0x7a, 0xba, 0x76, 0x8a, 0x9a, 0x9a, 0xba, 0xba, 0x9a, 0xaa, 0x76, 0x8a, 0xba,
+0xba, 0x9a, 0x9a, 0x9a, 0xba, 0x9a, 0x9a, 0x85, 0x68, 0xaa, 0xba, 0x9a, 0xba, 0x9a, 0xba, 0xb7,
+0x52, 0x55, 0x52, 0x55, 0x8a, 0xaa, 0x75, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x24, 0x25, 0x7a, 0xaa, 0x86, 0x89, 0xab,
+0xab, 0xa9, 0xab, 0xa9, 0xa9, 0x86, 0x79, 0xa9, 0xab, 0xa9, 0xa9, 0xa9, 0xa9, 0xab, 0xab, 0xa8,
+0x66, 0x8a, 0xa9, 0xa9, 0xa9, 0xab, 0xa9, 0xaa, 0x65, 0x45, 0x43, 0x25, 0x7c, 0x86, 0x56, 0x8a,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0x32, 0x52, 0x32, 0x52, 0x32, 0x52, 0x32,
+0x52, 0x34, 0x55, 0x7a, 0x9a, 0x96, 0x7a, 0xbb, 0x9a, 0x9a, 0xba, 0xba, 0xbb, 0xa8, 0x67, 0xaa,
+0xba, 0xba, 0x9a, 0xba, 0x9a, 0x9a, 0xbb, 0xaa, 0x86, 0x68, 0xaa, 0xba, 0xba, 0xba, 0x9a, 0x9a,
+0x76, 0x52, 0x32, 0x55, 0x56, 0x66, 0x68, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x23, 0x23, 0x23, 0x43, 0x23, 0x23, 0x23, 0x43, 0x23, 0x43, 0x23, 0x79, 0xa9, 0xa8, 0x68, 0xab,
+0xab, 0xa9, 0xa9, 0xab, 0xa9, 0xaa, 0x86, 0x7a, 0xaa, 0xa9, 0xa9, 0x99, 0xab, 0xa9, 0xa9, 0xab,
+0xa8, 0x66, 0x8a, 0xab, 0xa9, 0xab, 0xa9, 0xab, 0xc6, 0x03, 0x24, 0x45, 0x20, 0x57, 0xaa, 0xa9,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x32, 0x32, 0x52, 0x32, 0x32, 0x32, 0x52,
+0x52, 0x32, 0x34, 0x7a, 0xba, 0xb8, 0x67, 0xba, 0xba, 0x9b, 0xba, 0x9a, 0xba, 0x9b, 0xa7, 0x67,
+0x9a, 0xba, 0xba, 0x9a, 0xba, 0x9a, 0x9a, 0x9a, 0x9a, 0x87, 0x68, 0xba, 0xba, 0x9a, 0x9a, 0xba,
+0xa8, 0x76, 0x54, 0x55, 0x67, 0x8a, 0xba, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x24, 0x25, 0x6a, 0xab, 0xaa, 0x86, 0x8a,
+0xa9, 0xab, 0x99, 0xa9, 0xa9, 0xaa, 0xa9, 0x86, 0x78, 0xaa, 0xab, 0xa9, 0xa9, 0xab, 0xa9, 0xa9,
+0xa9, 0xa8, 0x76, 0x7a, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0x87, 0x66, 0x67, 0x88, 0xab, 0xa9, 0xa9,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0x32, 0x52, 0x32, 0x52, 0x32, 0x32, 0x32,
+0x54, 0x54, 0x52, 0x6a, 0xba, 0xba, 0x97, 0x7a, 0xba, 0xba, 0x9a, 0xba, 0xba, 0xba, 0x9b, 0xb7,
+0x67, 0x8a, 0x9a, 0xba, 0xba, 0xba, 0xba, 0xba, 0x9a, 0x9a, 0x97, 0x67, 0x9a, 0x9a, 0xbb, 0x9a,
+0xba, 0xba, 0x99, 0x9a, 0xaa, 0xba, 0x9a, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x23, 0x43, 0x23, 0x23, 0x23, 0x43, 0x23, 0x43, 0x23, 0x23, 0x23, 0x5a, 0xa9, 0xa9, 0xa8, 0x67,
+0xa9, 0xa9, 0xaa, 0xa9, 0xa9, 0xa9, 0xaa, 0xa9, 0x86, 0x68, 0xa9, 0xab, 0xa9, 0xa9, 0xa9, 0xa9,
+0xab, 0xa9, 0xaa, 0x86, 0x78, 0xa9, 0xa9, 0xa9, 0xab, 0xab, 0xaa, 0xab, 0xa9, 0xa9, 0xa9, 0xa9,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x52, 0x32, 0x52, 0x32, 0x52, 0x32, 0x32,
+0x52, 0x54, 0x32, 0x68, 0xba, 0x9a, 0xba, 0x76, 0x8a, 0xba, 0xba, 0xba, 0xba, 0x9a, 0xba, 0x9b,
+0xa8, 0x66, 0x7a, 0xba, 0xba, 0xba, 0xba, 0x9a, 0xba, 0xba, 0x9a, 0xa8, 0x66, 0x8a, 0x9a, 0xbb,
+0xba, 0x9a, 0x9a, 0xba, 0xba, 0x9a, 0x9a, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x43, 0x48, 0xa9, 0xab, 0xab, 0x86,
+0x68, 0xa9, 0x99, 0xa9, 0xa9, 0xa9, 0xab, 0xa9, 0x9b, 0xa7, 0x66, 0x8a, 0xab, 0xab, 0xa9, 0xab,
+0xa9, 0xab, 0xab, 0xaa, 0x86, 0x68, 0xaa, 0xa9, 0xa9, 0xab, 0xa9, 0xab, 0xa9, 0xab, 0xa9, 0xa9,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0x32, 0x52, 0x32, 0x52, 0x32, 0x52, 0x54,
+0x52, 0x54, 0x52, 0x57, 0xaa, 0xba, 0x9b, 0xa8, 0x66, 0x9a, 0xba, 0xba, 0x9b, 0xba, 0xbb, 0x9b,
+0x9b, 0xba, 0x86, 0x67, 0xba, 0xba, 0x9a, 0xba, 0xba, 0xba, 0xba, 0xba, 0xb8, 0x66, 0x8a, 0x9a,
+0xba, 0x9a, 0x9a, 0xba, 0x9b, 0xba, 0x9a, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x23, 0x23, 0x23, 0x43, 0x23, 0x23, 0x23, 0x23, 0x24, 0x23, 0x23, 0x26, 0xa9, 0xab, 0xa9, 0xab,
+0x86, 0x68, 0xa9, 0xab, 0xa9, 0xa9, 0xab, 0xa9, 0xa9, 0xab, 0xa8, 0x76, 0x67, 0x8a, 0xab, 0xab,
+0xaa, 0xa9, 0xab, 0xa9, 0xab, 0x86, 0x68, 0xa9, 0xa9, 0xab, 0xa9, 0x99, 0xa9, 0xa9, 0xa9, 0xab,
+0xd0, 0x00, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x32, 0x32, 0x52, 0x3d, 0x32, 0x32, 0xd4,
+0x32, 0x52, 0x54, 0x56, 0xaa, 0x9b, 0xba, 0x9a, 0xa8, 0x6d, 0x8a, 0x9b, 0x9a, 0xba, 0xba, 0x9a,
+0xba, 0x9a, 0xba, 0x98, 0x6d, 0x78, 0x9a, 0xba, 0xda, 0x9a, 0xba, 0x9a, 0x9a, 0xd8, 0x67, 0x8a,
+0xba, 0xbb, 0x9a, 0x9a, 0xba, 0xba, 0xba, 0x9a, 0xd0, 0x00, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x23, 0x23, 0x23, 0x23, 0x2d, 0x23, 0x23, 0xd3, 0x43, 0x23, 0x43, 0x45, 0x8b, 0xab, 0xa9, 0xab,
+0xa9, 0x86, 0x68, 0xa9, 0xa9, 0xab, 0xa9, 0xa9, 0xa9, 0xa9, 0xab, 0xaa, 0xad, 0x66, 0x77, 0x8a,
+0xab, 0xab, 0xa9, 0xa9, 0xab, 0xda, 0x86, 0x78, 0xa9, 0xa9, 0xab, 0xa9, 0xa9, 0xaa, 0xa9, 0xab,
+0xd0, 0x00, 0xd0, 0x0d, 0xdd, 0x00, 0x0d, 0xdd, 0x52, 0x32, 0x52, 0x32, 0xdd, 0xd2, 0x54, 0xd2,
+0xdd, 0x32, 0x3d, 0xdd, 0x6a, 0xba, 0x99, 0xba, 0x9a, 0xdd, 0x76, 0x7d, 0xdd, 0xba, 0xda, 0xbb,
+0xda, 0xbd, 0xdd, 0xba, 0xdd, 0xd8, 0x76, 0x6d, 0xda, 0xaa, 0x9d, 0xdd, 0x9b, 0xda, 0xbd, 0x77,
+0x9a, 0x9a, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xd0, 0x00, 0xd0, 0xd0, 0x00, 0x00, 0xd0, 0x00,
+0xd3, 0x43, 0x23, 0x23, 0x2d, 0x43, 0x23, 0xdd, 0x43, 0xd3, 0xd3, 0x25, 0xd8, 0xa9, 0xa9, 0xa9,
+0xab, 0xad, 0xa7, 0xd7, 0x89, 0xd9, 0xda, 0xa9, 0xd9, 0xd9, 0xa9, 0xa9, 0xad, 0xaa, 0xa8, 0x76,
+0xd7, 0x8a, 0xd9, 0xab, 0xa9, 0xd9, 0xda, 0x86, 0x8a, 0xa9, 0xab, 0xa9, 0xa9, 0xab, 0xab, 0xa8,
+0xd0, 0x00, 0xd0, 0x0d, 0xdd, 0x00, 0xdd, 0xdd, 0xd2, 0x52, 0x32, 0x52, 0x3d, 0x52, 0x32, 0xd2,
+0x32, 0xd4, 0xdd, 0xdd, 0xd7, 0xba, 0xba, 0x9a, 0xba, 0xbd, 0x9a, 0xd7, 0x67, 0xda, 0xad, 0xdd,
+0xda, 0x9d, 0xdd, 0xba, 0xbd, 0x9a, 0xba, 0xaa, 0xd7, 0x67, 0xda, 0xba, 0x9a, 0xdd, 0x9a, 0xa8,
+0x68, 0xba, 0xba, 0x9a, 0x9b, 0x9b, 0xba, 0x97, 0xd0, 0x00, 0xd0, 0x00, 0x00, 0xd0, 0xd0, 0x00,
+0x23, 0x23, 0x23, 0x23, 0x2d, 0x23, 0xd3, 0xd3, 0x43, 0xd3, 0xd3, 0x24, 0x26, 0x8a, 0xab, 0xa9,
+0xd9, 0xad, 0xa9, 0xda, 0x86, 0xd7, 0x8a, 0xa9, 0xd9, 0xa9, 0xa9, 0xd9, 0xad, 0xa9, 0xd9, 0xaa,
+0xd9, 0x86, 0xd6, 0x8a, 0xdb, 0xd9, 0xd9, 0xaa, 0x77, 0x8a, 0xab, 0xa9, 0xa9, 0xab, 0xa9, 0x86,
+0x0d, 0xdd, 0x00, 0xdd, 0xdd, 0x00, 0x0d, 0xdd, 0x52, 0x32, 0x52, 0x32, 0x52, 0xdd, 0x52, 0xd2,
+0x52, 0xd4, 0x5d, 0xdd, 0x55, 0x7a, 0x9a, 0xba, 0xbd, 0xdb, 0x9a, 0xbd, 0xdd, 0x86, 0x6d, 0xdd,
+0xba, 0xdd, 0xdd, 0xba, 0x9a, 0xdd, 0xba, 0xbd, 0xdd, 0xba, 0x8d, 0xdd, 0xaa, 0xdb, 0x9d, 0xba,
+0xc6, 0x8a, 0x9a, 0xba, 0xbb, 0x9a, 0xba, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x23, 0x23, 0x23, 0x43, 0x23, 0x23, 0x23, 0x43, 0x23, 0x23, 0x23, 0x23, 0x43, 0x68, 0xa9, 0xa9,
+0xaa, 0xab, 0xa9, 0xab, 0xaa, 0xa8, 0x76, 0x66, 0xc8, 0xaa, 0xa9, 0xa9, 0xab, 0xab, 0xa9, 0xab,
+0xab, 0xa9, 0xaa, 0x76, 0x67, 0xa9, 0xab, 0xab, 0xa7, 0x6a, 0xa9, 0xab, 0xa9, 0xa9, 0xaa, 0x65,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x32, 0x32, 0x52, 0x32, 0x32, 0x32, 0x52,
+0x32, 0x32, 0x32, 0x54, 0x24, 0x57, 0xaa, 0x9b, 0xba, 0x9a, 0xba, 0x9a, 0x9a, 0x9a, 0xaa, 0x77,
+0x66, 0x78, 0xaa, 0x9a, 0xba, 0xba, 0xba, 0x9b, 0xba, 0x9a, 0xba, 0xaa, 0x76, 0x7a, 0xba, 0xba,
+0xa8, 0x68, 0xba, 0x9a, 0xba, 0x9a, 0xb8, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x25, 0x7a, 0xa9,
+0xa9, 0xa9, 0xa9, 0xab, 0xab, 0xaa, 0xa9, 0xaa, 0x87, 0x66, 0x67, 0x88, 0xaa, 0xaa, 0xa9, 0xab,
+0xab, 0xab, 0xa9, 0xab, 0xa8, 0x67, 0x89, 0xa9, 0xa9, 0x67, 0xa9, 0xa9, 0xab, 0xab, 0xa7, 0x33,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0x32, 0x52, 0x32, 0x5d, 0x32, 0x52, 0x32,
+0x52, 0x32, 0x54, 0x54, 0x52, 0x22, 0x68, 0xaa, 0x9d, 0xda, 0x9a, 0xba, 0xba, 0xba, 0x9a, 0xbb,
+0xba, 0x98, 0xd7, 0x66, 0x78, 0x88, 0x9a, 0xba, 0xba, 0x9a, 0x9a, 0xba, 0xba, 0x86, 0x78, 0xaa,
+0x9a, 0x77, 0x9a, 0xba, 0x9b, 0xba, 0x86, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x23, 0x43, 0x23, 0x23, 0x2d, 0x43, 0x23, 0x23, 0x23, 0x43, 0x23, 0x23, 0x24, 0x43, 0x26, 0x7a,
+0xa9, 0xd9, 0xa9, 0xa9, 0xa9, 0xab, 0xa9, 0xa9, 0xab, 0xaa, 0xd8, 0x87, 0x66, 0x66, 0x77, 0x88,
+0xaa, 0xab, 0xa9, 0xab, 0xa9, 0xa8, 0x67, 0xa9, 0xaa, 0x86, 0x8a, 0xa9, 0xa9, 0xa8, 0x75, 0x46,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x52, 0x32, 0x52, 0xdd, 0xd2, 0x32, 0x5d,
+0xdd, 0x54, 0x32, 0x52, 0x52, 0xdd, 0xdd, 0x67, 0x9a, 0xdb, 0x9a, 0xbd, 0xdd, 0xba, 0xda, 0x9b,
+0xda, 0x9a, 0xda, 0xba, 0xa8, 0x87, 0x76, 0x66, 0x78, 0x8a, 0xaa, 0x99, 0xba, 0x9a, 0x86, 0x8a,
+0xba, 0x86, 0x8a, 0x9a, 0xba, 0xb8, 0x64, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x23, 0x23, 0x23, 0x23, 0x2d, 0x23, 0x23, 0xd3, 0x23, 0xd3, 0x23, 0x23, 0x43, 0xd0, 0x26, 0xd6,
+0x78, 0xda, 0xab, 0xa9, 0xa9, 0xd9, 0xdb, 0xa9, 0xd9, 0xa9, 0xd9, 0xa9, 0xa9, 0xaa, 0xa8, 0x88,
+0x66, 0x67, 0x8a, 0xa9, 0xab, 0xaa, 0xc6, 0x7a, 0xaa, 0x86, 0x89, 0xaa, 0xa9, 0x86, 0x45, 0x48,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0x32, 0x52, 0x32, 0x5d, 0x32, 0x52, 0xd2,
+0x52, 0xd4, 0x52, 0x32, 0x34, 0xdd, 0xdd, 0xc7, 0x66, 0xda, 0xba, 0x9d, 0xdd, 0xda, 0x9d, 0xdd,
+0xda, 0xbb, 0xba, 0x9b, 0xba, 0xba, 0x9a, 0xba, 0xa8, 0x76, 0x67, 0x8a, 0xb9, 0xba, 0xa8, 0x6a,
+0xbb, 0x86, 0x8a, 0xba, 0x9a, 0x75, 0x54, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x23, 0x23, 0x23, 0x43, 0x2d, 0x23, 0xd3, 0xd3, 0x23, 0xd3, 0x23, 0x43, 0x23, 0xd3, 0x45, 0x7a,
+0x86, 0xd6, 0x8a, 0xdb, 0xa9, 0xdb, 0xa9, 0xa9, 0xd9, 0xa9, 0xab, 0xab, 0xa9, 0xa9, 0xa9, 0xa9,
+0xab, 0xa8, 0x76, 0x67, 0xaa, 0x99, 0xa8, 0x68, 0xaa, 0x86, 0x8b, 0xa9, 0xa7, 0x53, 0x20, 0x6c,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x32, 0x32, 0x52, 0x32, 0xdd, 0x32, 0x5d,
+0xdd, 0x32, 0x32, 0x52, 0x32, 0xd2, 0x35, 0x68, 0xad, 0xdd, 0x67, 0x8d, 0xdd, 0xda, 0xbd, 0xdd,
+0x9a, 0xba, 0xda, 0x9a, 0xba, 0x9a, 0xba, 0x9a, 0x9a, 0x9a, 0xa8, 0x75, 0x7a, 0xba, 0xba, 0x67,
+0xba, 0x86, 0x9a, 0xba, 0x86, 0x54, 0x54, 0x67, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x43, 0x23, 0x20, 0x46,
+0x8a, 0xa8, 0x76, 0x66, 0x88, 0xaa, 0xa9, 0xa9, 0xab, 0xa9, 0xa9, 0xaa, 0xa9, 0xa9, 0xa9, 0xab,
+0xa9, 0xa9, 0xab, 0x87, 0x67, 0xaa, 0x9a, 0x66, 0xaa, 0x76, 0xa9, 0xa8, 0x65, 0x43, 0x23, 0x25,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0x32, 0x52, 0x32, 0x52, 0x32, 0x52, 0x32,
+0x52, 0x32, 0x52, 0x32, 0x32, 0x54, 0x52, 0x52, 0x68, 0xaa, 0xba, 0x87, 0x66, 0x78, 0x8a, 0xaa,
+0xba, 0xba, 0xbb, 0x99, 0xba, 0xba, 0xba, 0xba, 0x9a, 0xbb, 0x9a, 0xba, 0x76, 0x8a, 0xba, 0x67,
+0xa8, 0x77, 0x9a, 0xa6, 0x52, 0x32, 0x54, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x23, 0x43, 0x23, 0x23, 0x23, 0x43, 0x23, 0x23, 0x23, 0x43, 0x23, 0x23, 0x23, 0x43, 0x23, 0x23,
+0x46, 0x8a, 0xa9, 0xa9, 0x87, 0x66, 0x56, 0x77, 0x88, 0xaa, 0xaa, 0xab, 0xaa, 0xa9, 0xa9, 0xa9,
+0xa9, 0xab, 0xab, 0xa9, 0xc6, 0x68, 0xaa, 0x66, 0xa8, 0x68, 0xa8, 0x75, 0x23, 0x43, 0x23, 0x43,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x52, 0x32, 0x52, 0x32, 0x52, 0x32, 0x52,
+0x32, 0x52, 0x32, 0x52, 0x32, 0x52, 0x32, 0x32, 0x52, 0x78, 0xaa, 0x9a, 0xaa, 0x98, 0x87, 0x65,
+0x66, 0x67, 0x78, 0x88, 0xaa, 0xaa, 0xaa, 0xba, 0xaa, 0xba, 0xba, 0x9a, 0xa7, 0x68, 0xba, 0x67,
+0xa7, 0x6c, 0xa7, 0x63, 0x54, 0x52, 0x32, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x24,
+0x25, 0x46, 0x8b, 0xab, 0xa9, 0xaa, 0xa9, 0x88, 0x76, 0x65, 0x56, 0x66, 0x66, 0x66, 0x77, 0x77,
+0x78, 0xa9, 0xab, 0xab, 0xa8, 0x68, 0xa8, 0x67, 0x86, 0x8c, 0x75, 0x23, 0x45, 0x23, 0x23, 0x23,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0x32, 0x52, 0x32, 0x52, 0x32, 0x52, 0x32,
+0x52, 0x32, 0x52, 0x32, 0x34, 0x52, 0x32, 0x54, 0x33, 0x55, 0x6c, 0xaa, 0xba, 0x9a, 0xba, 0xba,
+0xba, 0x98, 0x88, 0x77, 0x67, 0x66, 0x67, 0x66, 0x66, 0x66, 0x8a, 0x9a, 0xba, 0x68, 0xa7, 0x6c,
+0x66, 0xc8, 0x62, 0x34, 0x52, 0x32, 0x52, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x23, 0x23, 0x23, 0x43, 0x23, 0x23, 0x23, 0x43, 0x23, 0x23, 0x23, 0x43, 0x23, 0x23, 0x24, 0x23,
+0x23, 0x43, 0x26, 0x8a, 0xab, 0xab, 0xa9, 0xab, 0xa9, 0xa9, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+0xc8, 0x86, 0x56, 0x89, 0xcc, 0x57, 0xc6, 0x67, 0x57, 0x75, 0x23, 0x43, 0x23, 0x23, 0x23, 0x43,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x32, 0x32, 0x52, 0x32, 0x32, 0x32, 0x52,
+0x32, 0x32, 0x32, 0x52, 0x32, 0x52, 0x32, 0x32, 0x32, 0x52, 0x53, 0x68, 0x9a, 0xba, 0xba, 0x9a,
+0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xaa, 0xba, 0xaa, 0xba, 0x86, 0x7a, 0xa8, 0x67, 0x72, 0x66,
+0x77, 0x64, 0x52, 0x52, 0x32, 0x32, 0x32, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
+0x45, 0x23, 0x43, 0x25, 0x78, 0xa9, 0xa9, 0xab, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9,
+0xa9, 0xab, 0xa7, 0x58, 0xc6, 0x26, 0x23, 0x25, 0x23, 0x43, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0x32, 0x52, 0x32, 0x52, 0x32, 0x52, 0x32,
+0x52, 0x32, 0x52, 0x32, 0x52, 0x32, 0x52, 0x32, 0x52, 0x52, 0x32, 0x32, 0x57, 0x8a, 0xba, 0x9a,
+0xba, 0xba, 0x9a, 0xba, 0x9a, 0xba, 0x9b, 0x9a, 0xbb, 0x9a, 0xba, 0x67, 0x86, 0x52, 0x52, 0x34,
+0x53, 0x52, 0x54, 0x52, 0x52, 0x32, 0x52, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x23, 0x43, 0x23, 0x23, 0x23, 0x43, 0x23, 0x23, 0x23, 0x43, 0x23, 0x23, 0x23, 0x43, 0x23, 0x43,
+0x23, 0x43, 0x23, 0x23, 0x45, 0x67, 0x8a, 0xab, 0xa9, 0xa9, 0xa9, 0xab, 0xa9, 0xa9, 0xa9, 0xa9,
+0xab, 0xa9, 0xaa, 0x67, 0x63, 0x45, 0x23, 0x43, 0x23, 0x43, 0x43, 0x23, 0x23, 0x43, 0x23, 0x23,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x52, 0x32, 0x52, 0x32, 0x52, 0x32, 0x52,
+0x32, 0x52, 0x32, 0x52, 0x32, 0x32, 0x32, 0x52, 0x32, 0x54, 0x54, 0x54, 0x24, 0x55, 0x67, 0x8a,
+0xaa, 0xba, 0x9a, 0x9a, 0x9a, 0x9a, 0xba, 0x9a, 0x9a, 0x9b, 0xa8, 0x66, 0x52, 0x32, 0x52, 0x35,
+0x32, 0x52, 0x32, 0x32, 0x32, 0x52, 0x32, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
+0x23, 0x23, 0x25, 0x23, 0x43, 0x23, 0x25, 0x67, 0x8a, 0xaa, 0xa9, 0xa9, 0xa9, 0xab, 0xa9, 0xa9,
+0xa9, 0xab, 0x87, 0x25, 0x23, 0x23, 0x43, 0x24, 0x43, 0x22, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0x32, 0x52, 0x32, 0x52, 0x32, 0x52, 0x32,
+0x52, 0x32, 0x52, 0x32, 0x52, 0x32, 0x32, 0x52, 0x54, 0x32, 0x52, 0x52, 0x32, 0x34, 0x52, 0x55,
+0x66, 0x78, 0xba, 0xaa, 0xbb, 0xba, 0xba, 0xba, 0xba, 0xba, 0x75, 0x24, 0x52, 0x25, 0x52, 0x54,
+0x52, 0x34, 0x52, 0x52, 0x52, 0x32, 0x52, 0x32,
+};
+
+static const uint32_t palette_Title_Screen[] =
+{
+	0x000000, 0xffff00, 0x232325, 0x221e1b,
+	0x1f1f1f, 0x2e2600, 0x463007, 0x816b15,
+	0x977d29, 0xecba0d, 0xedc211, 0xf8c514,
+	0x9e9c9d, 0x00ffff,
+};
+
+const tImage Title_Screen =
+{
+	IMAGE_FMT_4BPP_UNCOMP,
+	112,
+	121,
+	14,
+	palette_Title_Screen,
+	pixel_Title_Screen,
+};
+
+static const unsigned char pixel_Final_Screen[] =
+{
+0xc0, 0x21, 0xf0, 0xa0, 0x21, 0xf0, 0xf0, 0xa0, 0x01, 0x20, 0x01, 0xf0, 0x80, 0x01, 0x20, 0x01,
+0xf0, 0xf0, 0x90, 0x01, 0x50, 0x21, 0x10, 0x11, 0x00, 0x01, 0x20, 0x21, 0x70, 0x01, 0x20, 0x01,
+0x00, 0x01, 0x20, 0x01, 0x10, 0x21, 0x10, 0x01, 0x00, 0x11, 0xf0, 0x80, 0x01, 0x00, 0x21, 0x40,
+0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x20, 0x01, 0x60, 0x01, 0x20, 0x01, 0x00,
+0x01, 0x20, 0x01, 0x00, 0x01, 0x20, 0x01, 0x00, 0x11, 0x10, 0x01, 0xf0, 0x70, 0x01, 0x20, 0x01,
+0x10, 0x31, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x41, 0x60, 0x01, 0x20, 0x01, 0x00, 0x01,
+0x20, 0x01, 0x00, 0x41, 0x00, 0x01, 0xf0, 0xb0, 0x01, 0x20, 0x01, 0x00, 0x01, 0x20, 0x01, 0x00,
+0x01, 0x20, 0x01, 0x00, 0x01, 0xa0, 0x01, 0x20, 0x01, 0x10, 0x01, 0x00, 0x01, 0x10, 0x01, 0x40,
+0x01, 0xf0, 0xc0, 0x31, 0x10, 0x31, 0x00, 0x01, 0x20, 0x01, 0x10, 0x21, 0x80, 0x21, 0x30, 0x01,
+0x30, 0x21, 0x10, 0x01, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
+0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
+0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
+0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
+0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
+0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
+0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
+0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
+0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
+0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
+0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
+0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
+0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
+0xf0, 0xf0, 0xf0, 0xf0, 0x40, 0x32, 0xf0, 0xf0, 0x32, 0x10, 0x42, 0x10, 0x32, 0x00, 0x42, 0x00,
+0x42, 0xb0, 0x02, 0x20, 0x02, 0xf0, 0xe0, 0x02, 0x20, 0x02, 0x00, 0x02, 0x40, 0x02, 0x40, 0x02,
+0x60, 0x02, 0xd0, 0x02, 0x20, 0x02, 0x00, 0x02, 0x00, 0x12, 0x20, 0x22, 0x20, 0x22, 0x20, 0x22,
+0x70, 0x02, 0x20, 0x02, 0x00, 0x02, 0x40, 0x02, 0x40, 0x02, 0x60, 0x02, 0xd0, 0x32, 0x10, 0x12,
+0x10, 0x02, 0x00, 0x02, 0x20, 0x02, 0x00, 0x02, 0x40, 0x02, 0xa0, 0x32, 0x10, 0x32, 0x20, 0x22,
+0x10, 0x32, 0x30, 0x02, 0xd0, 0x02, 0x40, 0x02, 0x40, 0x42, 0x10, 0x22, 0x20, 0x22, 0x70, 0x02,
+0x00, 0x02, 0x20, 0x02, 0x80, 0x02, 0x00, 0x02, 0x60, 0x02, 0xd0, 0x02, 0x40, 0x02, 0x40, 0x02,
+0x80, 0x02, 0x40, 0x02, 0x60, 0x02, 0x10, 0x02, 0x10, 0x02, 0x80, 0x02, 0x00, 0x02, 0x60, 0x02,
+0xd0, 0x02, 0x40, 0x02, 0x50, 0x22, 0x10, 0x32, 0x10, 0x32, 0x70, 0x02, 0x20, 0x02, 0x00, 0x42,
+0x00, 0x32, 0x10, 0x42, 0x20, 0x02, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
+0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0x90, 0x02,
+0xf0, 0x60, 0x12, 0xf0, 0xf0, 0x80, 0x02, 0x80, 0x02, 0xf0, 0x70, 0x02, 0xf0, 0xb0, 0x32, 0xf0,
+0x10, 0x22, 0x30, 0x22, 0x70, 0x32, 0x30, 0x02, 0x30, 0x22, 0x10, 0x02, 0x20, 0x02, 0x70, 0x22,
+0x10, 0x02, 0x20, 0x02, 0x10, 0x22, 0x20, 0x12, 0x20, 0x02, 0x00, 0x12, 0x10, 0x02, 0x30, 0x02,
+0x20, 0x02, 0x60, 0x02, 0x20, 0x02, 0x20, 0x02, 0x60, 0x02, 0x00, 0x02, 0x20, 0x02, 0xa0, 0x02,
+0x00, 0x02, 0x20, 0x02, 0x40, 0x02, 0x20, 0x02, 0x20, 0x12, 0x10, 0x02, 0x00, 0x02, 0x30, 0x02,
+0x20, 0x02, 0x60, 0x32, 0x30, 0x02, 0x30, 0x32, 0x10, 0x32, 0x70, 0x32, 0x10, 0x32, 0x10, 0x32,
+0x20, 0x02, 0x20, 0x02, 0x20, 0x02, 0x00, 0x02, 0x10, 0x02, 0x00, 0x02, 0x20, 0x02, 0x60, 0x02,
+0x60, 0x02, 0x20, 0x02, 0x20, 0x02, 0x40, 0x02, 0x60, 0x02, 0x20, 0x02, 0x40, 0x02, 0x00, 0x02,
+0x20, 0x02, 0x20, 0x02, 0x20, 0x02, 0x20, 0x02, 0x10, 0x12, 0x20, 0x22, 0x70, 0x02, 0x50, 0x22,
+0x20, 0x32, 0x10, 0x22, 0x80, 0x32, 0x10, 0x22, 0x20, 0x32, 0x10, 0x22, 0x10, 0x02, 0x20, 0x02,
+};
+
+static const uint32_t palette_Final_Screen[] =
+{
+	0x000000, 0xffffff, 0x00ffff,
+};
+
+const tImage Final_Screen =
+{
+	IMAGE_FMT_4BPP_COMP_RLE4,
+	77,
+	69,
+	3,
+	palette_Final_Screen,
+	pixel_Final_Screen,
+};
@@ -0,0 +1,19 @@
+// static_screens.h
+// The static parts of the trainer's screens, to be drawn at NAME_X, NAME_Y
+// over a screen cleared to black.
+// Generated by host/screen_gen.c (make -C host screens); do not edit.
+
+#ifndef STATIC_SCREENS_H_
+#define STATIC_SCREENS_H_
+
+#include "GrLib/grlib/grlib.h"
+
+extern const Graphics_Image Title_Screen;
+#define TITLE_SCREEN_X 16
+#define TITLE_SCREEN_Y 7
+
+extern const Graphics_Image Final_Screen;
+#define FINAL_SCREEN_X 25
+#define FINAL_SCREEN_Y 17
+
+#endif // STATIC_SCREENS_H_
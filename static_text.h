@@ -0,0 +1,31 @@
+// static_text.h
+// Widths in g_sFontFixed6x8Subset of the trainer's string literals, for
+// Graphics_drawStringCenteredWidth().
+// Generated by host/text_gen.c (make -C host text); do not edit.
+
+#ifndef STATIC_TEXT_H_
+#define STATIC_TEXT_H_
+
+#define TEXT_WIDTH_C                           6  // "C"
+#define TEXT_WIDTH_D                           6  // "D"
+#define TEXT_WIDTH_E                           6  // "E"
+#define TEXT_WIDTH_F                           6  // "F"
+#define TEXT_WIDTH_G                           6  // "G"
+#define TEXT_WIDTH_A                           6  // "A"
+#define TEXT_WIDTH_B                           6  // "B"
+#define TEXT_WIDTH_SELECT_QUESTIONS          108  // "Select # Questions"
+#define TEXT_WIDTH_LEFT_1_RIGHT_1            120  // "LEFT: -1   RIGHT: +1"
+#define TEXT_WIDTH_UP_START                   54  // "UP: start"
+#define TEXT_WIDTH_MUSIC_TRAINER              78  // "Music Trainer"
+#define TEXT_WIDTH_3_NOTES_PLAYED_1_2_3      126  // "3 notes played: 1,2,3"
+#define TEXT_WIDTH_CORRECT                    48  // "Correct!"
+#define TEXT_WIDTH_WRONG                      30  // "Wrong"
+#define TEXT_WIDTH_ANSWER                     42  // "Answer:"
+#define TEXT_WIDTH_1_2ND_VS_1ST_NOTE         108  // "1) 2nd vs 1st note"
+#define TEXT_WIDTH_UP_LATER_HIGHER           102  // "UP = later higher"
+#define TEXT_WIDTH_DOWN_LATER_LOWER          108  // "DOWN = later lower"
+#define TEXT_WIDTH_2_3RD_VS_2ND_NOTE         108  // "2) 3rd vs 2nd note"
+#define TEXT_WIDTH_UP                         12  // "Up"
+#define TEXT_WIDTH_DOWN                       24  // "Down"
+
+#endif // STATIC_TEXT_H_
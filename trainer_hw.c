@@ -5,11 +5,28 @@
 #include <stdint.h>
 
 #include "LcdDriver/lcd_driver.h"
+#include "LcdDriver/lcd_framebuffer.h"
+#include "LcdDriver/lcd_tiles.h"
+#include "LcdDriver/lower_driver.h"
 #include "Grlib/grlib/grlib.h"
 #include "music_trainer.h"
+#include "static_fonts.h"
 
 Graphics_Context g_sContext;
 
+// backlight brightness in percent, in use and after a while without input
+#define LCD_BACKLIGHT_PERCENT       70
+#define LCD_BACKLIGHT_DIM_PERCENT   15
+
+// idle times before the display saves power
+#define LCD_IDLE_DIM_MS         5000
+#define LCD_IDLE_PARTIAL_MS     10000
+#define LCD_IDLE_OFF_MS         20000
+#define LCD_IDLE_SLEEP_MS       60000
+
+// set while the joystick press that woke the display is held
+static uint8_t g_joyWaking;
+
 // delay
 void delay_ms(uint16_t ms)
 {
@@ -39,18 +56,55 @@ void Init_ClockSystem(void)
 //  LCD + grlib
 void LCD_InitGraphics(void)
 {
-    Crystalfontz128x128_Init();
+    // The panel stays dark until the title screen is flushed, so it is
+    // written once and never shows the blank or a half-drawn screen
+#ifdef LCD_NO_FRAMEBUFFER
+    Crystalfontz128x128_InitColor(GRAPHICS_COLOR_BLACK);
+#else
+    Crystalfontz128x128_InitColor(LCD_INIT_NO_FILL);
+#endif
     Crystalfontz128x128_SetOrientation(0);
 
     // Turn LCD backlight on
-    P2DIR |= BIT6;
-    P2OUT |= BIT6;
-
-    Graphics_initContext(&g_sContext, &g_sCrystalfontz128x128);
+    Crystalfontz128x128_SetBacklight(LCD_BACKLIGHT_PERCENT);
+    Crystalfontz128x128_SetDimBacklight(LCD_BACKLIGHT_DIM_PERCENT);
+
+    // Save power on screens left alone: dim the backlight, keep only the
+    // idle area shown, then switch the panel off, then put it to sleep
+    Crystalfontz128x128_SetIdleTimeout(LCD_POWER_DIM, LCD_IDLE_DIM_MS);
+    Crystalfontz128x128_SetIdleTimeout(LCD_POWER_PARTIAL, LCD_IDLE_PARTIAL_MS);
+    Crystalfontz128x128_SetIdleTimeout(LCD_POWER_OFF, LCD_IDLE_OFF_MS);
+    Crystalfontz128x128_SetIdleTimeout(LCD_POWER_SLEEP, LCD_IDLE_SLEEP_MS);
+
+#ifdef LCD_NO_FRAMEBUFFER
+    // Draw straight to the panel; clears only repaint what was drawn, and
+    // the panel starts out black
+    Crystalfontz128x128_TileInitColor(GRAPHICS_COLOR_BLACK);
+    Graphics_initContext(&g_sContext, &g_sCrystalfontz128x128_Tiles);
+#else
+    // Draw into the FRAM framebuffer; screens reach the panel on
+    // Graphics_flushBuffer(), the first one in full
+    Crystalfontz128x128_BufferInit();
+    Graphics_initContext(&g_sContext, &g_sCrystalfontz128x128_Buffered);
+#endif
     Graphics_setBackgroundColor(&g_sContext, GRAPHICS_COLOR_BLACK);
     Graphics_setForegroundColor(&g_sContext, GRAPHICS_COLOR_WHITE);
-    GrContextFontSet(&g_sContext, &g_sFontFixed6x8);
-    Graphics_clearDisplay(&g_sContext);
+    // g_sFontFixed6x8 holding only the characters the trainer draws
+    // (make -C host fonts)
+    GrContextFontSet(&g_sContext,
+                     (const Graphics_Font *)&g_sFontFixed6x8Subset);
+}
+
+// Rows to keep shown once the current screen has been idle for a while
+void LCD_SetIdleArea(uint16_t y0, uint16_t y1)
+{
+    Crystalfontz128x128_SetPartialArea(y0, y1);
+}
+
+// Called while waiting; lets the display drop into its power saving states
+void LCD_Idle(void)
+{
+    Crystalfontz128x128_PowerPoll();
 }
 
 // joystick thresholds
@@ -104,7 +158,7 @@ void Joystick_ReadAxes(uint16_t *py, uint16_t *px)
     if (py) *py = y;
 }
 
-JoystickDir Joystick_GetDir(void)
+static JoystickDir Joystick_ReadDir(void)
 {
     uint16_t x, y;
     Joystick_ReadAxes(&y, &x);  // y first x second
@@ -124,33 +178,54 @@ JoystickDir Joystick_GetDir(void)
     return DIR_CENTER;
 }
 
+// Any press wakes the display.  A press that lit a dark panel is not passed
+// on, since the player could not see what it would answer; one that only
+// undimmed it or left partial mode is.
+JoystickDir Joystick_GetDir(void)
+{
+    JoystickDir dir = Joystick_ReadDir();
+    uint8_t state;
+
+    if (dir == DIR_CENTER) {
+        g_joyWaking = 0;
+        LCD_Idle();
+        return DIR_CENTER;
+    }
+
+    state = Crystalfontz128x128_PowerWake();
+    if ((state == LCD_POWER_OFF) || (state == LCD_POWER_SLEEP)) {
+        g_joyWaking = 1;
+    }
+    return g_joyWaking ? DIR_CENTER : dir;
+}
+
 void Buzzer_Init(void)
 {
     P2DIR  |= BIT7;
     P2SEL0 |= BIT7;
     P2SEL1 &= ~BIT7;
 
-    TB0CTL   = TBSSEL__SMCLK | MC__STOP | TBCLR;   // SMCLK source
-    TB0CCTL6 = OUTMOD_7;
-    TB0CCR0  = 0;
+    // Timer_B0 already runs for the backlight; the buzzer output (TB0.6)
+    // stays low until a note plays
+    TB0CCTL6 = OUTMOD_0;
     TB0CCR6  = 0;
 }
 
 static void Buzzer_SetFrequency(uint16_t freq)
 {
     if (freq == 0) {
-        // Stop timer to stop buzzer
-        TB0CTL = TBSSEL__SMCLK | MC__STOP | TBCLR;
+        // Hold the output low and give the timer back to the backlight
+        TB0CCTL6 = OUTMOD_0;
+        HAL_LCD_setTimerPeriod(0);
         return;
     }
 
-    uint16_t period = (uint16_t)(16000000UL / freq);
+    uint16_t period = (uint16_t)(HAL_LCD_SMCLK_HZ / freq);
 
-    TB0CCR0  = period;
     TB0CCR6  = period / 2;
     TB0CCTL6 = OUTMOD_7;
 
-    TB0CTL   = TBSSEL__SMCLK | MC__UP | TBCLR;   // Up mode  start timer
+    HAL_LCD_setTimerPeriod(period);   // Up mode  restart timer
 }
 
 void Buzzer_PlayNote(uint16_t freq, uint16_t duration_ms)